@@ -0,0 +1,221 @@
+#include <CE/Core/MimicNode.hpp>
+#include <CE/Core/RectangleNode.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr float CELL_SIZE = 8;
+constexpr unsigned long COLUMNS = 256;
+constexpr unsigned long CHAIN_DEPTH = 100;
+constexpr unsigned long TARGET_OPERATIONS = 2000000;
+constexpr unsigned long MAX_REMOVALS = 1000;
+
+enum class Shape { FLAT, DEEP };
+
+class BenchRoot : public ce::MimicNode
+{
+public:
+    using ce::Node::update;
+    using ce::Node::drawToTarget;
+    using ce::Node::select;
+    using ce::Node::children;
+};
+
+struct Result
+{
+    std::string name;
+    Shape shape;
+    unsigned long nodeCount;
+    unsigned long iterations;
+    double nanosecondsPerOperation;
+};
+
+const char *getShapeName(Shape shape)
+{
+    return shape == Shape::FLAT ? "flat" : "deep";
+}
+
+sf::Vector2f getCellPosition(unsigned long index)
+{
+    return { (index % COLUMNS) * CELL_SIZE, (index / COLUMNS) * CELL_SIZE };
+}
+
+std::shared_ptr<ce::RectangleNode> createLeaf()
+{
+    return ce::createShared<ce::RectangleNode>(CELL_SIZE, CELL_SIZE, sf::Color::White, true);
+}
+
+std::shared_ptr<BenchRoot> buildTree(Shape shape, unsigned long nodeCount,
+                                     std::vector<std::shared_ptr<ce::TransformableNode> > &leaves)
+{
+    auto root = ce::createShared<BenchRoot>();
+    if (shape == Shape::FLAT) {
+        for (unsigned long i = 0; i < nodeCount; i++) {
+            auto leaf = createLeaf();
+            leaf->setPos(getCellPosition(i).x, getCellPosition(i).y);
+            root->addChild(leaf);
+            leaves.push_back(leaf);
+        }
+        return root;
+    }
+
+    unsigned long createdCount = 0;
+    for (unsigned long chain = 0; createdCount < nodeCount; chain++) {
+        std::shared_ptr<ce::Node> parent = root;
+        const unsigned long depth = std::min(CHAIN_DEPTH, nodeCount - createdCount);
+        for (unsigned long level = 0; level + 1 < depth; level++) {
+            auto link = ce::createShared<ce::MimicNode>();
+            if (level == 0) {
+                link->setPos(getCellPosition(chain).x, getCellPosition(chain).y);
+            }
+            parent->addChild(link);
+            parent = link;
+        }
+        auto leaf = createLeaf();
+        if (depth == 1) {
+            leaf->setPos(getCellPosition(chain).x, getCellPosition(chain).y);
+        }
+        parent->addChild(leaf);
+        leaves.push_back(leaf);
+        createdCount += depth;
+    }
+    return root;
+}
+
+double measure(unsigned long iterations, unsigned long operationsPerIteration, const std::function<void()> &body)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++) {
+        body();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (iterations * operationsPerIteration);
+}
+
+void runShape(Shape shape, unsigned long nodeCount, sf::RenderTarget &target, std::vector<Result> &results)
+{
+    const unsigned long iterations = std::max(1ul, TARGET_OPERATIONS / nodeCount);
+    auto addResult = [&results, shape, nodeCount](const std::string &name, unsigned long iterations, double value) {
+        results.push_back({ name, shape, nodeCount, iterations, value });
+    };
+
+    std::vector<std::shared_ptr<ce::TransformableNode> > treeLeaves;
+    auto root = buildTree(shape, nodeCount, treeLeaves);
+    const sf::Vector2f area(COLUMNS * CELL_SIZE, (nodeCount / COLUMNS + 1) * CELL_SIZE);
+    std::mt19937 random(nodeCount);
+    std::uniform_real_distribution<float> xDistribution(0, std::min(area.x, nodeCount * CELL_SIZE));
+    std::uniform_real_distribution<float> yDistribution(0, area.y);
+
+    addResult("update", iterations, measure(iterations, 1, [&root]() { root->update(); }));
+    addResult("draw", iterations, measure(iterations, 1, [&root, &target]() { root->drawToTarget(target); }));
+    addResult("make_transformed", iterations, measure(iterations, 1, [&root, &treeLeaves]() {
+        root->move(1, 0);
+        for (auto &leaf : treeLeaves) {
+            leaf->getCombinedTransform();
+        }
+    }));
+    root->setPos(0, 0);
+
+    const unsigned long selectIterations = std::min(TARGET_OPERATIONS / 10, iterations * 100);
+    addResult("select", selectIterations, measure(selectIterations, 1, [&]() {
+        root->select(sf::Vector2i((int) xDistribution(random), (int) yDistribution(random)));
+    }));
+    root->enableSpatialIndex(CELL_SIZE * 4);
+    addResult("select_indexed", selectIterations, measure(selectIterations, 1, [&]() {
+        root->select(sf::Vector2i((int) xDistribution(random), (int) yDistribution(random)));
+    }));
+    root->disableSpatialIndex();
+
+    addResult("bounds_cached", iterations * 100, measure(iterations * 100, 1, [&root]() { root->getWidth(); }));
+    addResult("bounds_invalidated", iterations, measure(iterations, 1, [&root]() {
+        root->children.front()->move(0, 0);
+        root->getWidth();
+    }));
+
+    std::vector<std::shared_ptr<ce::TransformableNode> > leaves;
+    for (unsigned long i = 0; i < nodeCount; i++) {
+        leaves.push_back(createLeaf());
+    }
+    auto container = ce::createShared<ce::MimicNode>();
+    addResult("add_child", 1, measure(1, nodeCount, [&container, &leaves]() {
+        for (auto &leaf : leaves) {
+            container->addChild(leaf);
+        }
+    }));
+    std::shuffle(leaves.begin(), leaves.end(), random);
+    const unsigned long removalCount = std::min(MAX_REMOVALS, nodeCount);
+    addResult("remove_child", 1, measure(1, removalCount, [&container, &leaves, removalCount]() {
+        for (unsigned long i = 0; i < removalCount; i++) {
+            container->removeChild(leaves[i]);
+        }
+    }));
+    addResult("remove_children", 1, measure(1, std::max(1ul, nodeCount - removalCount), [&container]() {
+        container->removeChildren();
+    }));
+}
+
+void printText(const std::vector<Result> &results)
+{
+    for (auto &result : results) {
+        std::cout << result.name << '/' << getShapeName(result.shape) << '/' << result.nodeCount << ": "
+                  << result.nanosecondsPerOperation << " ns/op (" << result.iterations << " iterations)\n";
+    }
+}
+
+void printJson(const std::vector<Result> &results)
+{
+    std::cout << "[\n";
+    for (unsigned long i = 0; i < results.size(); i++) {
+        const Result &result = results[i];
+        std::cout << "  {\"name\": \"" << result.name << "\", \"shape\": \"" << getShapeName(result.shape)
+                  << "\", \"nodes\": " << result.nodeCount << ", \"iterations\": " << result.iterations
+                  << ", \"ns_per_op\": " << result.nanosecondsPerOperation << '}'
+                  << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    std::cout << "]\n";
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    bool isJson = false;
+    unsigned long maxNodeCount = 100000;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            isJson = true;
+        } else if (std::strcmp(argv[i], "--max-nodes") == 0 && i + 1 < argc) {
+            maxNodeCount = std::stoul(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--json] [--max-nodes N]\n";
+            return 1;
+        }
+    }
+
+    sf::RenderTexture target;
+    if (!target.create(1024, 1024)) {
+        std::cerr << "Failed to create render texture\n";
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (unsigned long nodeCount = 10; nodeCount <= maxNodeCount; nodeCount *= 10) {
+        runShape(Shape::FLAT, nodeCount, target, results);
+        runShape(Shape::DEEP, nodeCount, target, results);
+    }
+
+    if (isJson) {
+        printJson(results);
+    } else {
+        printText(results);
+    }
+    return 0;
+}
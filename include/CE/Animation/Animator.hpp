@@ -0,0 +1,62 @@
+#ifndef CE_ANIMATOR_HPP
+#define CE_ANIMATOR_HPP
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include <vector>
+
+namespace ce {
+
+class ProgressBar;
+class TransformableNode;
+class VisualNode;
+
+enum class Easing { LINEAR, EASE_IN, EASE_OUT, EASE_IN_OUT };
+
+// Each stage owns one, reached with getStage().getAnimator(), so tweens advance once per stage tick.
+class Animator
+{
+public:
+    void moveTo(const std::shared_ptr<TransformableNode> &node, const sf::Vector2f &position,
+                       const sf::Time &duration, Easing easing = Easing::LINEAR);
+    void rotateTo(const std::shared_ptr<TransformableNode> &node, float rotation,
+                         const sf::Time &duration, Easing easing = Easing::LINEAR);
+    void scaleTo(const std::shared_ptr<TransformableNode> &node, float scale,
+                        const sf::Time &duration, Easing easing = Easing::LINEAR);
+    void fade(const std::shared_ptr<VisualNode> &node, float from, float to,
+                     const sf::Time &duration, Easing easing = Easing::LINEAR);
+    void fillTo(const std::shared_ptr<ProgressBar> &bar, float value,
+                       const sf::Time &duration, Easing easing = Easing::LINEAR);
+
+    bool checkAnimated(const TransformableNode &node) const;
+    void stop(const TransformableNode &node);
+    void advance(const sf::Time &elapsed);
+
+private:
+    enum Property { X, Y, ROTATION, SCALE, ALPHA, VALUE, PROPERTY_COUNT };
+
+    struct Tween
+    {
+        TransformableNode *key;
+        std::weak_ptr<TransformableNode> node;
+        Property property;
+        Easing easing;
+        float from;
+        float to;
+        float elapsed;
+        float duration;
+    };
+
+    std::vector<Tween> tweens;
+    bool isSorted = true;
+
+    void add(const std::shared_ptr<TransformableNode> &node, Property property, float from, float to,
+                    const sf::Time &duration, Easing easing);
+    static float ease(Easing easing, float progress);
+    unsigned long advanceNode(unsigned long first, float elapsed);
+};
+
+}
+
+#endif
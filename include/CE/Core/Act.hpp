@@ -2,7 +2,8 @@
 #define CE_ACT_HPP
 
 #include <CE/Core/MimicNode.hpp>
-#include <CE/Core/Stage.hpp>
+#include <CE/Core/BaseStage.hpp>
+#include <CE/Core/Camera.hpp>
 #include <SFML/Window/Keyboard.hpp>
 
 namespace ce {
@@ -12,7 +13,7 @@ class Act : public Node
 public:
     enum class Mode { STATIC, MOVABLE_BY_MOUSE, CENTERED_ON_NODE };
 
-    Act(Mode contentMode, Stage &stage, const sf::Color &bgColor = sf::Color::Black);
+    Act(Mode contentMode, BaseStage &stage, const sf::Color &bgColor = sf::Color::Black);
 
     void onMouseMoved(const sf::Vector2i &mousePosition) override;
     void onMouseLeft() override;
@@ -20,11 +21,13 @@ public:
     void onLeftMouseButtonReleased() override;
     void onRightMouseButtonPressed();
     void onRightMouseButtonReleased() override;
+    virtual void onKeyPressed(sf::Keyboard::Key key) {}
     virtual void onKeyReleased(sf::Keyboard::Key key) {}
 
     const sf::Color &getBgColor() const;
     const sf::Transform &getCombinedTransform() override;
-    const sf::Window &getWindow() const override;
+    BaseStage &getStage() const override;
+    float getInterpolation() const override;
 
     void setCenter(const std::shared_ptr<TransformableNode> &value);
     void setContent(const std::shared_ptr<TransformableNode> &value);
@@ -34,14 +37,21 @@ public:
     void setBottomUi(const std::shared_ptr<TransformableNode> &value);
     void setOverlayUi(const std::shared_ptr<TransformableNode> &value);
 
+    // Cameras are drawn over the act in the order they were added; hide a subtree with setVisible
+    // to show it only through cameras.
+    void addCamera(const std::shared_ptr<Camera> &camera);
+    void removeCamera(const std::shared_ptr<Camera> &camera);
+
     virtual void setUpNodes();
     void update() override;
+    void draw(sf::RenderTarget &target);
+    void draw(DrawList &list);
 
 protected:
     sf::Color bgColor;
 
     bool checkPointOnIt(const sf::Vector2i &point) override;
-    void declareEvent(const sf::String &name);
+    void declareEvent(EventId event);
 
 private:
     static constexpr unsigned int SCROLL_SPEED = 5;
@@ -51,9 +61,13 @@ private:
     sf::Vector2i savedMousePosition;
     bool isRightMouseButtonPressed = false;
     bool isMouseMovedWithRightButton = false;
-    Stage &stage;
+    BaseStage &stage;
 
     std::shared_ptr<Node> selectedNode;
+    std::shared_ptr<Camera> selectedCamera;
+    bool isSelectionCacheable = false;
+    unsigned long selectionHitTestGeneration = 0;
+    unsigned long selectionPathStamp = 0;
     std::shared_ptr<MimicNode> contentLayer = std::make_shared<MimicNode>();
 
     std::shared_ptr<TransformableNode> center;
@@ -63,7 +77,12 @@ private:
     std::shared_ptr<TransformableNode> topUi;
     std::shared_ptr<TransformableNode> bottomUi;
     std::shared_ptr<TransformableNode> overlayUi;
+    std::vector<std::shared_ptr<Camera> > cameras;
 
+    std::shared_ptr<Camera> findCamera(const sf::Vector2i &mousePosition) const;
+    bool checkSelectionCached(const sf::Vector2i &mousePosition);
+    void cacheSelection();
+    static void placeNode(TransformableNode &node, float x, float y);
     void updateUi(const std::shared_ptr<TransformableNode> &oldUi, const std::shared_ptr<TransformableNode> &newUi);
     virtual void resizeUi() {}
 };
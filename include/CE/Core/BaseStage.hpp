@@ -0,0 +1,77 @@
+#ifndef CE_BASESTAGE_HPP
+#define CE_BASESTAGE_HPP
+
+#include <CE/Animation/Animator.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/Input.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Event/Listener.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Event.hpp>
+#include <deque>
+#include <memory>
+
+namespace ce {
+
+class Act;
+
+// Each stage has its own animator, input state, frame budget and profiler. EventQueue and ResourceManager stay
+// process-wide and are flushed by every stage, so several stages in one process must be updated from the same thread.
+class BaseStage
+{
+public:
+    virtual ~BaseStage() = default;
+
+    virtual void onEvent(const std::shared_ptr<Act> &act, EventId event) {}
+    virtual void onQualityChanged(float quality) {}
+    void setAct(const std::shared_ptr<Act> &value);
+    const std::shared_ptr<Act> &getAct() const;
+    const sf::Time &getUpdateInterval() const;
+    void setUpdateInterval(const sf::Time &value);
+    float getInterpolation() const;
+    const sf::Time &getTickTime() const;
+    Animator &getAnimator();
+    Input &getInput();
+    FrameBudget &getFrameBudget();
+    virtual sf::Vector2u getSize() const = 0;
+    virtual sf::Vector2i getMousePosition() const;
+    virtual sf::RenderTarget *getRenderTarget();
+    void pushEvent(const sf::Event &event);
+    void start();
+    void stop();
+
+protected:
+    std::shared_ptr<Act> act;
+
+    void update();
+    virtual bool checkRunning() const;
+    virtual bool pollInputEvent(sf::Event &event);
+
+private:
+    static constexpr unsigned int MAX_UPDATES_PER_FRAME = 10;
+
+    Animator animator;
+    Input input;
+    FrameBudget frameBudget;
+    Profiler profiler;
+    sf::Time updateInterval;
+    sf::Time lag;
+    sf::Time tickTime;
+    sf::Clock clock;
+    float interpolation = 0;
+    bool isStopped = false;
+    std::deque<sf::Event> pushedEvents;
+
+    virtual void onUpdated() {}
+    virtual void prepareFrame() {}
+    virtual void onResized(const sf::Vector2u &size) {}
+    virtual void onClosed();
+    virtual sf::Time getElapsedTime();
+    virtual void drawFrame();
+    virtual void stopRendering() {}
+};
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef CE_BASICNODE_HPP
+#define CE_BASICNODE_HPP
+
+#include <CE/Core/TransformableNode.hpp>
+#include <CE/constant.hpp>
+
+namespace ce {
+
+// Implements the transform setters of Derived over the sf::Transformable returned by Derived::getBody().
+template <typename Derived, typename Base>
+class BasicNode : public Base
+{
+public:
+    using Base::Base;
+
+    void setScale(float value) override
+    {
+        getLocalBody().setScale(value, value);
+        this->makeTransformed();
+    }
+
+    void setRotation(float value) override
+    {
+        getLocalBody().setRotation(value * 180 / MATH_PI);
+        this->makeTransformed();
+    }
+
+    void setOrigin(float x, float y) override
+    {
+        getLocalBody().setOrigin(x, y);
+        this->makeTransformed();
+    }
+
+    void setPos(float x, float y) override
+    {
+        getLocalBody().setPosition(x, y);
+        this->makeTransformed();
+    }
+
+    void rotate(float angle) override
+    {
+        getLocalBody().rotate(angle * 180 / MATH_PI);
+        this->makeTransformed();
+    }
+
+    void move(float offsetX, float offsetY) override
+    {
+        getLocalBody().move(offsetX, offsetY);
+        this->makeTransformed();
+    }
+
+protected:
+    sf::Transformable &getLocalBody()
+    {
+        return static_cast<Derived &>(*this).getBody();
+    }
+
+private:
+    const sf::Transformable &getTransformable() const override
+    {
+        return static_cast<const Derived &>(*this).getBody();
+    }
+};
+
+}
+
+#endif
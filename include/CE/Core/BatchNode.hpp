@@ -0,0 +1,66 @@
+#ifndef CE_BATCHNODE_HPP
+#define CE_BATCHNODE_HPP
+
+#include <CE/Core/MimicNode.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <atomic>
+
+namespace ce {
+
+class VisualNode;
+
+class BatchNode : public MimicNode
+{
+public:
+    explicit BatchNode(bool isSelectable = false);
+    ~BatchNode() override;
+
+    void drawToTarget(sf::RenderTarget &target) override;
+    void drawToList(DrawList &list) override;
+
+protected:
+    void onDescendantsChanged() override;
+    void collectBatched(BatchNode &batch) override {}
+
+private:
+    friend class VisualNode;
+
+    struct Slot
+    {
+        VisualNode *node;
+        unsigned long layer;
+        unsigned long vertexIndex;
+        unsigned long vertexCount;
+        unsigned long transformStamp;
+        bool isChanged;
+    };
+
+    struct Layer
+    {
+        const sf::Texture *texture;
+        sf::VertexArray vertices;
+    };
+
+    bool isRebuildNeeded = true;
+    bool isDrawing = false;
+    std::atomic<bool> isSlotChangePending { false };
+    unsigned long checkedTransformVersion = 0;
+    std::vector<Slot> slots;
+    std::vector<Layer> layers;
+    std::vector<unsigned long> changedSlots;
+
+    void addSlot(VisualNode &node);
+    void releaseSlot(unsigned long index);
+    void makeSlotChanged(unsigned long index);
+    void deferSlotChange(unsigned long index);
+    void collectDeferredSlots();
+    unsigned long getTransformStamp(const VisualNode &node) const;
+    void prepareLayers();
+    void rebuild();
+    void findTransformedSlots();
+    void updateChangedSlots();
+};
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CE_CACHEDNODE_HPP
+#define CE_CACHEDNODE_HPP
+
+#include <CE/Core/MimicNode.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+namespace ce {
+
+class CachedNode : public MimicNode
+{
+public:
+    explicit CachedNode(bool isSelectable = false);
+
+    void drawToTarget(sf::RenderTarget &target) override;
+    void drawToList(DrawList &list) override;
+
+protected:
+    void onDescendantsChanged() override;
+    void collectBatched(BatchNode &batch) override {}
+
+private:
+    bool isCacheValid = false;
+    unsigned long descendantsStamp = 0;
+    sf::Transform cachedTransform;
+    sf::RenderTexture renderTexture;
+    sf::Sprite sprite;
+
+    void prepareCache();
+    void redraw();
+    sf::Transform getSpriteTransform();
+};
+
+}
+
+#endif
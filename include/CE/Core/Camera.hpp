@@ -0,0 +1,40 @@
+#ifndef CE_CAMERA_HPP
+#define CE_CAMERA_HPP
+
+#include <CE/Core/TransformableNode.hpp>
+#include <SFML/Graphics/View.hpp>
+
+namespace ce {
+
+// Shows a subtree through its own view; the center is in the content's local units.
+class Camera
+{
+public:
+    explicit Camera(const std::shared_ptr<TransformableNode> &content,
+                    const sf::FloatRect &viewport = sf::FloatRect(0, 0, 1, 1));
+
+    const std::shared_ptr<TransformableNode> &getContent() const;
+    const sf::FloatRect &getViewport() const;
+    void setViewport(const sf::FloatRect &value);
+    const sf::Vector2f &getCenter() const;
+    void setCenter(float x, float y);
+    float getZoom() const;
+    void setZoom(float value);
+    float getRotation() const;
+    void setRotation(float value);
+
+    sf::View getView(const sf::Vector2u &targetSize) const;
+    bool checkPixelInViewport(const sf::Vector2i &pixel, const sf::Vector2u &targetSize) const;
+    sf::Vector2i mapPixel(const sf::Vector2i &pixel, const sf::Vector2u &targetSize) const;
+
+private:
+    std::shared_ptr<TransformableNode> content;
+    sf::FloatRect viewport;
+    sf::Vector2f center;
+    float zoom = 1;
+    float rotation = 0;
+};
+
+}
+
+#endif
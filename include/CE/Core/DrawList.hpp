@@ -0,0 +1,46 @@
+#ifndef CE_DRAWLIST_HPP
+#define CE_DRAWLIST_HPP
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <memory>
+#include <vector>
+
+namespace ce {
+
+class DrawList
+{
+public:
+    void reset(const sf::View &view, const sf::Color &clearColor);
+    const sf::View &getView() const;
+    void setView(const sf::View &value);
+    unsigned long getEntryCount() const;
+
+    sf::Vertex *addVertices(const sf::Texture *texture, unsigned long count);
+    void addVertices(const sf::VertexArray &array, const sf::Texture *texture, const sf::Transform &transform);
+    void addDrawable(std::unique_ptr<sf::Drawable> drawable, const sf::Transform &transform);
+
+    void drawToTarget(sf::RenderTarget &target) const;
+
+private:
+    struct Entry
+    {
+        const sf::Texture *texture;
+        sf::Transform transform;
+        unsigned long firstVertex;
+        unsigned long vertexCount;
+        bool isMergeable;
+        std::unique_ptr<sf::Drawable> drawable;
+        bool isViewChange;
+    };
+
+    std::vector<sf::View> views;
+    sf::Color clearColor;
+    std::vector<sf::Vertex> vertices;
+    std::vector<Entry> entries;
+};
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef CE_FRAMEBUDGET_HPP
+#define CE_FRAMEBUDGET_HPP
+
+#include <CE/Core/Node.hpp>
+#include <SFML/System/Time.hpp>
+
+namespace ce {
+
+// Lowers the quality when frames take longer than the budget and raises it back when there is headroom.
+// Optional work asks getQuality or checkDue; HIGH priority nodes always get full quality.
+// Each stage owns one and makes it current when its frame starts, so nodes ask getCurrent().
+class FrameBudget
+{
+public:
+    static FrameBudget &getCurrent();
+
+    FrameBudget() = default;
+    ~FrameBudget();
+    FrameBudget(const FrameBudget &) = delete;
+    FrameBudget &operator=(const FrameBudget &) = delete;
+
+    const sf::Time &getBudget() const;
+    void setBudget(const sf::Time &value);
+    float getMinQuality() const;
+    void setMinQuality(float value);
+
+    unsigned long getFrame() const;
+    float getQuality() const;
+    float getQuality(const Node &node) const;
+    bool checkDue(const Node &node) const;
+
+    bool startFrame(const sf::Time &workTime);
+
+private:
+    static constexpr float SMOOTHING = 0.1f;
+    static constexpr float HEADROOM = 0.8f;
+    static constexpr float STEP_DOWN = 0.1f;
+    static constexpr float STEP_UP = 0.02f;
+    static constexpr unsigned int MAX_STRIDE = 8;
+
+    static FrameBudget *current;
+
+    sf::Time budget;
+    float minQuality = 0.25f;
+    unsigned long frame = 0;
+    float averageTime = 0;
+    float quality = 1;
+};
+
+}
+
+#endif
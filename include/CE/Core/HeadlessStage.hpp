@@ -0,0 +1,30 @@
+#ifndef CE_HEADLESSSTAGE_HPP
+#define CE_HEADLESSSTAGE_HPP
+
+#include <CE/Core/BaseStage.hpp>
+
+namespace ce {
+
+class HeadlessStage : public BaseStage
+{
+public:
+    explicit HeadlessStage(const sf::Vector2u &size);
+
+    sf::Vector2u getSize() const override;
+    void setTimeStep(const sf::Time &value);
+    void resize(const sf::Vector2u &value);
+    void advance(unsigned long frameCount = 1);
+
+protected:
+    void onResized(const sf::Vector2u &value) override;
+
+private:
+    sf::Vector2u size;
+    sf::Time timeStep = sf::seconds(1 / 60.0f);
+
+    sf::Time getElapsedTime() override;
+};
+
+}
+
+#endif
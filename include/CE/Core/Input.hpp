@@ -0,0 +1,38 @@
+#ifndef CE_INPUT_HPP
+#define CE_INPUT_HPP
+
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <bitset>
+#include <vector>
+
+namespace ce {
+
+// Keyboard and mouse state of one stage, fed from that stage's events and reached with getStage().getInput().
+class Input
+{
+public:
+    bool checkKeyPressed(sf::Keyboard::Key key) const;
+    const sf::Vector2i &getMousePosition() const;
+    const std::vector<sf::Vector2i> &getMouseMoves() const;
+    void enableMouseHistory();
+    void disableMouseHistory();
+
+private:
+    friend class BaseStage;
+
+    std::bitset<sf::Keyboard::KeyCount> pressedKeys;
+    sf::Vector2i mousePosition;
+    std::vector<sf::Vector2i> mouseMoves;
+    bool isMouseHistoryEnabled = false;
+
+    void startFrame();
+    bool pressKey(sf::Keyboard::Key key);
+    void releaseKey(sf::Keyboard::Key key);
+    void releaseKeys();
+    void moveMouse(const sf::Vector2i &position);
+};
+
+}
+
+#endif
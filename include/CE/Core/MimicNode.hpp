@@ -1,31 +1,35 @@
 #ifndef CE_MIMICNODE_HPP
 #define CE_MIMICNODE_HPP
 
-#include <CE/Core/TransformableNode.hpp>
+#include <CE/Core/BasicNode.hpp>
 #include <CE/Event/Listener.hpp>
 
 namespace ce {
 
-class MimicNode : public TransformableNode
+class MimicNode : public BasicNode<MimicNode, TransformableNode>
 {
 public:
     explicit MimicNode(bool isSelectable = false);
 
     float getWidth() override;
     float getHeight() override;
-    void setScale(float value) override;
     sf::FloatRect getRect() override;
-    void setRotation(float value) override;
 
-    void setOrigin(float x, float y) override;
-    void setPos(float x, float y) override;
-    void rotate(float angle) override;
-    void move(float offsetX, float offsetY) override;
+protected:
+    void onDescendantsChanged() override;
+    void onChildRectChanged(TransformableNode &child) override;
 
 private:
+    friend class BasicNode<MimicNode, TransformableNode>;
+
     sf::Transformable transformable;
+    bool isResized = true;
+    sf::Vector2f size;
 
-    const sf::Transformable &getTransformable() const override;
+    sf::Transformable &getBody() { return transformable; }
+    const sf::Transformable &getBody() const { return transformable; }
+    void makeResized();
+    void updateSize();
 };
 
 }
@@ -1,19 +1,28 @@
 #ifndef CE_NODE_HPP
 #define CE_NODE_HPP
 
+#include <CE/Core/SpatialGrid.hpp>
 #include <CE/Utility/EnableSharedFromThis.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Transformable.hpp>
-#include <SFML/Window/Window.hpp>
+#include <atomic>
+#include <limits>
 
 namespace ce {
 
+class BaseStage;
+class BatchNode;
+class DrawList;
 class TransformableNode;
 
 class Node : public EnableSharedFromThis<Node>
 {
 public:
+    enum class Priority { LOW, NORMAL, HIGH };
+
+    static unsigned long getHitTestGeneration();
     explicit Node(bool isSelectable = false);
+    ~Node() override;
 
     virtual void onMouseEntered() {}
     virtual void onMouseMoved(const sf::Vector2i &mousePosition) {}
@@ -24,32 +33,110 @@ public:
 
     bool checkSelectable() const;
     void setSelectable(bool value);
+    bool checkVisible() const;
+    void setVisible(bool value);
+    Priority getPriority() const;
+    void setPriority(Priority value);
+    bool checkOnScreen() const;
 
     virtual const sf::Transform &getCombinedTransform() = 0;
-    std::shared_ptr<Node> getParent() const;
-    virtual const sf::Window &getWindow() const;
+    Node *getParent() const;
+    virtual BaseStage &getStage() const;
+    virtual float getInterpolation() const;
+    int getZIndex() const;
+    void setZIndex(int value);
 
     void addChild(const std::shared_ptr<TransformableNode> &child);
     void removeChild(const std::shared_ptr<TransformableNode> &child);
     void removeChildren(unsigned long firstIndex = 0, long lastIndex = -1);
 
+    void enableSpatialIndex(float cellSize);
+    void disableSpatialIndex();
+
+    // Updates the children concurrently on JobPool::getShared(). Inside those subtrees onUpdated may only
+    // touch its own subtree and post events with postEvent; it must not add or remove this node's
+    // children, query combined transforms, change text or fonts, or reach nodes outside its subtree.
+    void enableParallelUpdate();
+    void disableParallelUpdate();
+
 protected:
+    // Removed children leave null entries until the next traversal compacts them via prepareChildren().
     std::vector<std::shared_ptr<TransformableNode> > children;
 
-    std::shared_ptr<Node> select(const sf::Vector2i &mousePosition);
+    void prepareChildren();
+    Node *select(const sf::Vector2i &mousePosition);
+    TransformableNode *selectChild(const sf::Vector2i &point);
+    bool checkHitCacheable(Node &node) const;
+    unsigned long getHitPathStamp(Node &node) const;
+    bool checkStillHit(Node &node, const sf::Vector2i &point);
+    static Node *selectInChild(TransformableNode &child, const sf::Vector2i &point);
+    static bool checkInParallelUpdate();
     virtual void update();
     virtual bool checkPointOnIt(const sf::Vector2i &point) = 0;
     virtual void makeTransformed() {}
     virtual void drawToTarget(sf::RenderTarget &target);
+    virtual void drawToList(DrawList &list);
+    virtual void onDescendantsChanged();
+    virtual void onChildRectChanged(TransformableNode &child);
+    virtual void collectBatched(BatchNode &batch);
+    unsigned long getDescendantsTransformVersion() const;
+    unsigned long getDescendantsChangeVersion() const;
+    // The bounds of the visible children and their descendants, in local units.
+    sf::FloatRect getChildrenBounds();
+    static void drawChildToTarget(TransformableNode &child, sf::RenderTarget &target);
+    static void drawChildToList(TransformableNode &child, DrawList &list);
 
 private:
+    friend class TransformableNode;
+    friend class TransformStore;
+    friend class VisualNode;
+    friend class CachedNode;
+
+    static std::atomic<unsigned long> hitTestGeneration;
+    static std::atomic<unsigned int> parallelUpdateCount;
+
+    static void updateChild(TransformableNode &child);
+    static sf::FloatRect getChildRect(TransformableNode &child);
+    // The rect of the child and all of its visible descendants, in this node's local units.
+    static sf::FloatRect getChildBounds(TransformableNode &child);
+    static bool checkChildInView(TransformableNode &child, const sf::Transform &transform,
+                                 const sf::FloatRect &viewRect);
+    static bool checkPointOnChild(TransformableNode &child, const sf::Vector2i &point);
+
     bool isSelectable;
-    std::weak_ptr<Node> parent;
+    bool isVisible = true;
+    Priority priority = Priority::NORMAL;
+    unsigned long drawnFrame = 0;
+    bool isCaching = false;
+    Node *parent = nullptr;
+    unsigned long childIndex = 0;
+    int zIndex = 0;
+    int topZIndex = std::numeric_limits<int>::min();
+    bool isOrderChanged = false;
+    unsigned long tombstoneCount = 0;
+    unsigned int iterationDepth = 0;
+    unsigned long combinedVersion = 0;
+    std::atomic<unsigned long> descendantsTransformVersion { 0 };
+    std::atomic<unsigned long> descendantsChangeVersion { 0 };
+    unsigned long childRectVersion = 0;
+    sf::FloatRect childrenRect;
+    std::atomic<bool> isChildrenRectValid { false };
+    std::unique_ptr<SpatialGrid> spatialIndex;
+    bool isSpatialIndexBuilt = false;
+    bool isParallelUpdateEnabled = false;
+    bool isUpdatingInParallel = false;
+    bool isRectChangePending = false;
+    std::atomic<bool> isDescendantsChangePending { false };
 
     virtual void onAdded() {}
     virtual void onUpdated() {}
 
-    void setParent(const std::shared_ptr<Node> &value);
+    bool checkSelectableDescendants() const;
+    void makeChildrenRectChanged();
+    void setParent(Node *value);
+    void buildSpatialIndex();
+    void updateChildIndices(unsigned long firstIndex);
+    void updateChildrenInParallel();
 };
 
 }
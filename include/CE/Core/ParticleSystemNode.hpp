@@ -0,0 +1,72 @@
+#ifndef CE_PARTICLESYSTEMNODE_HPP
+#define CE_PARTICLESYSTEMNODE_HPP
+
+#include <CE/Core/BasicNode.hpp>
+#include <CE/Core/VisualNode.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <random>
+#include <vector>
+
+namespace ce {
+
+class ParticleSystemNode : public BasicNode<ParticleSystemNode, VisualNode>
+{
+public:
+    explicit ParticleSystemNode(unsigned long capacity = 1024, float particleSize = 2);
+
+    unsigned long getParticleCount() const;
+    void setGravity(const sf::Vector2f &value);
+    // Overrides the stage's tick time as the integration step; zero follows the stage again.
+    void setTimeStep(const sf::Time &value);
+    void emit(const sf::Vector2f &position, const sf::Vector2f &velocity, float life, const sf::Color &color);
+    void burst(unsigned long count, const sf::Vector2f &position, float speed, float life, const sf::Color &color);
+    void clear();
+
+    void setAlpha(float value) override;
+    float getWidth() override;
+    float getHeight() override;
+    sf::FloatRect getRect() override;
+
+    void drawToTarget(sf::RenderTarget &target) override;
+    void drawToList(DrawList &list) override;
+
+protected:
+    void update() override;
+
+private:
+    static constexpr unsigned long PARALLEL_THRESHOLD = 16384;
+    static constexpr unsigned long CHUNK_SIZE = 4096;
+
+    const unsigned long capacity;
+    const float particleSize;
+    sf::Vector2f gravity;
+    float timeStep = 0;
+    float currentStep = 0;
+    float alpha = 1;
+    std::minstd_rand random;
+    sf::Transformable transformable;
+    sf::FloatRect bounds;
+    sf::VertexArray vertices;
+
+    std::vector<float> positionsX;
+    std::vector<float> positionsY;
+    std::vector<float> velocitiesX;
+    std::vector<float> velocitiesY;
+    std::vector<float> lives;
+    std::vector<float> maxLives;
+    std::vector<sf::Color> colors;
+
+    friend class BasicNode<ParticleSystemNode, VisualNode>;
+
+    sf::Transformable &getBody() { return transformable; }
+    const sf::Transformable &getBody() const { return transformable; }
+    const sf::Drawable &getDrawable() const override;
+    void integrate(unsigned long first, unsigned long last);
+    void removeDeadParticles();
+    void writeVertices(unsigned long first, unsigned long last);
+    void runChunked(void (ParticleSystemNode::*pass)(unsigned long, unsigned long));
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CE_PROFILER_HPP
+#define CE_PROFILER_HPP
+
+#include <SFML/System/Clock.hpp>
+#include <atomic>
+
+namespace ce {
+
+struct FrameStats
+{
+    sf::Time eventTime;
+    sf::Time updateTime;
+    sf::Time drawTime;
+    sf::Time displayTime;
+    unsigned long drawCallCount = 0;
+    unsigned long updatedNodeCount = 0;
+    unsigned long visitedNodeCount = 0;
+    unsigned long transformCount = 0;
+
+    sf::Time getFrameTime() const;
+    sf::Time getWorkTime() const;
+};
+
+// Each stage owns a profiler and starts its frame on it; the static functions record into the profiler whose
+// frame was started last. Counts made on a render thread go to whichever profiler is current at the time.
+class Profiler
+{
+public:
+    enum class Phase { EVENTS, UPDATE, DRAW, DISPLAY };
+
+    Profiler() = default;
+    ~Profiler();
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    static const FrameStats &getLastFrame();
+
+    static void startFrame(Profiler &profiler);
+    static void finishPhase(Phase phase);
+
+    static void countDrawCall() { drawCallCount.fetch_add(1, std::memory_order_relaxed); }
+    static void countUpdatedNode() { updatedNodeCount.fetch_add(1, std::memory_order_relaxed); }
+    static void countVisitedNode() { visitedNodeCount.fetch_add(1, std::memory_order_relaxed); }
+    static void countTransform(unsigned long count = 1) { transformCount.fetch_add(count, std::memory_order_relaxed); }
+
+private:
+    static std::atomic<unsigned long> drawCallCount;
+    static std::atomic<unsigned long> updatedNodeCount;
+    static std::atomic<unsigned long> visitedNodeCount;
+    static std::atomic<unsigned long> transformCount;
+    static Profiler *current;
+
+    FrameStats currentFrame;
+    FrameStats lastFrame;
+    sf::Clock phaseClock;
+
+    static Profiler &getCurrent();
+    void collectCounts();
+};
+
+}
+
+#endif
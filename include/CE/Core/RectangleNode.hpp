@@ -1,12 +1,13 @@
 #ifndef CE_RECTANGLENODE_HPP
 #define CE_RECTANGLENODE_HPP
 
+#include <CE/Core/BasicNode.hpp>
 #include <CE/Core/VisualNode.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
 namespace ce {
 
-class RectangleNode : public VisualNode
+class RectangleNode : public BasicNode<RectangleNode, VisualNode>
 {
 public:
     RectangleNode(float width, float height, const sf::Color &color = sf::Color::White, bool isSelectable = false);
@@ -16,21 +17,23 @@ public:
     virtual void setWidth(float value);
     float getHeight() override;
     virtual void setHeight(float value);
-    void setScale(float scale) override;
     sf::FloatRect getRect() override;
-    void setRotation(float value) override;
 
     virtual void setSize(float width, float height);
-    void setOrigin(float x, float y) override;
-    void setPos(float x, float y) override;
-    void rotate(float angle) override;
-    void move(float offsetX, float offsetY) override;
 
 protected:
     sf::RectangleShape shape;
 
+    bool checkBatchable() const override;
+    const sf::Texture *getTexture() const override;
+    void writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const override;
+    std::unique_ptr<sf::Drawable> copyDrawable() const override;
+
 private:
-    const sf::Transformable &getTransformable() const override;
+    friend class BasicNode<RectangleNode, VisualNode>;
+
+    sf::RectangleShape &getBody() { return shape; }
+    const sf::RectangleShape &getBody() const { return shape; }
     const sf::Drawable &getDrawable() const override;
 };
 
@@ -0,0 +1,43 @@
+#ifndef CE_SPATIALGRID_HPP
+#define CE_SPATIALGRID_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace ce {
+
+class TransformableNode;
+
+class SpatialGrid
+{
+public:
+    explicit SpatialGrid(float cellSize);
+
+    const std::vector<unsigned long> &getCandidates(const sf::Vector2f &point) const;
+
+    void insert(const TransformableNode *node, unsigned long index, const sf::FloatRect &rect);
+    void update(const TransformableNode *node, const sf::FloatRect &rect);
+    void clear();
+
+private:
+    struct Entry
+    {
+        unsigned long index;
+        sf::IntRect cells;
+    };
+
+    const float cellSize;
+    std::unordered_map<const TransformableNode *, Entry> entries;
+    std::unordered_map<sf::Uint64, std::vector<unsigned long> > cells;
+
+    static sf::Uint64 getKey(int x, int y);
+    sf::IntRect getCellRange(const sf::FloatRect &rect) const;
+    void addToCells(unsigned long index, const sf::IntRect &range);
+    void removeFromCells(unsigned long index, const sf::IntRect &range);
+};
+
+}
+
+#endif
@@ -1,32 +1,42 @@
 #ifndef CE_SPRITENODE_HPP
 #define CE_SPRITENODE_HPP
 
+#include <CE/Core/BasicNode.hpp>
 #include <CE/Core/VisualNode.hpp>
+#include <CE/Resource/TextureHandle.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 
 namespace ce {
 
-class SpriteNode : public VisualNode
+class SpriteNode : public BasicNode<SpriteNode, VisualNode>
 {
 public:
     explicit SpriteNode(const sf::Texture &texture, bool isSelectable = false);
+    explicit SpriteNode(const TextureHandle &texture, bool isSelectable = false);
 
     void setAlpha(float value) override;
     float getWidth() override;
     float getHeight() override;
-    void setScale(float value) override;
     sf::FloatRect getRect() override;
-    void setRotation(float value) override;
 
-    void setOrigin(float x, float y) override;
-    void setPos(float x, float y) override;
-    void rotate(float angle) override;
-    void move(float offsetX, float offsetY) override;
+protected:
+    void update() override;
+    bool checkBatchable() const override;
+    const sf::Texture *getTexture() const override;
+    void writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const override;
 
 private:
     sf::Sprite sprite;
+    // Kept while the sprite draws from it, so ResourceManager::releaseUnused() cannot free the texture.
+    TextureHandle textureHandle;
+    bool isTextureApplied = true;
 
-    const sf::Transformable &getTransformable() const override;
+    friend class Node;
+    friend class BasicNode<SpriteNode, VisualNode>;
+
+    sf::Sprite &getBody() { return sprite; }
+    const sf::Sprite &getBody() const { return sprite; }
+    void applyTexture();
     const sf::Drawable &getDrawable() const override;
 };
 
@@ -1,29 +1,51 @@
 #ifndef CE_STAGE_HPP
 #define CE_STAGE_HPP
 
+#include <CE/Core/BaseStage.hpp>
+#include <CE/Core/DrawList.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <CE/Event/Listener.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace ce {
 
-class Act;
-
-class Stage : public sf::RenderWindow
+class Stage : public BaseStage, public sf::RenderWindow
 {
 public:
     Stage(const sf::VideoMode &mode, const sf::String &title, sf::Uint32 style = sf::Style::Default);
+    ~Stage() override;
+
+    sf::Vector2u getSize() const override;
+    sf::Vector2i getMousePosition() const override;
+    sf::RenderTarget *getRenderTarget() override;
+    void enableRenderThread();
+    void disableRenderThread();
 
-    virtual void onEvent(const std::shared_ptr<Act> &act, const sf::String &name) {}
-    void setAct(const std::shared_ptr<Act> &value);
-    const std::shared_ptr<Act> &getAct() const;
-    void start();
+protected:
+    bool checkRunning() const override;
+    bool pollInputEvent(sf::Event &event) override;
 
 private:
     sf::View view;
-    std::shared_ptr<Act> act;
-
-    virtual void onUpdated() {}
-    void update();
+    bool isRenderThreadEnabled = false;
+    std::thread renderThread;
+    std::mutex renderMutex;
+    std::condition_variable renderCondition;
+    DrawList drawLists[2];
+    unsigned int recordedListIndex = 0;
+    DrawList *submittedList = nullptr;
+    bool isRendering = false;
+    bool isRenderStopped = false;
+
+    void prepareFrame() override;
+    void onResized(const sf::Vector2u &size) override;
+    void onClosed() override;
+    void drawFrame() override;
+    void stopRendering() override;
+    void startRenderThread();
+    void stopRenderThread();
+    void render();
 };
 
 }
@@ -0,0 +1,28 @@
+#ifndef CE_TEXTURESTAGE_HPP
+#define CE_TEXTURESTAGE_HPP
+
+#include <CE/Core/HeadlessStage.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace ce {
+
+class TextureStage : public HeadlessStage
+{
+public:
+    explicit TextureStage(const sf::Vector2u &size);
+
+    sf::RenderTarget *getRenderTarget() override;
+    const sf::Texture &getTexture() const;
+    sf::Image capture() const;
+
+private:
+    sf::RenderTexture texture;
+
+    void onResized(const sf::Vector2u &value) override;
+    void drawFrame() override;
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef CE_TILEMAPNODE_HPP
+#define CE_TILEMAPNODE_HPP
+
+#include <CE/Core/BasicNode.hpp>
+#include <CE/Core/VisualNode.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <vector>
+
+namespace ce {
+
+class TileMapNode : public BasicNode<TileMapNode, VisualNode>
+{
+public:
+    static constexpr int EMPTY_TILE = -1;
+    static constexpr unsigned int CHUNK_SIZE = 32;
+
+    TileMapNode(const sf::Texture &tileset, const sf::Vector2u &tileSize,
+                unsigned int columnCount, unsigned int rowCount, bool isSelectable = false);
+
+    void onMouseMoved(const sf::Vector2i &mousePosition) override;
+    void onMouseLeft() override;
+
+    unsigned int getColumnCount() const;
+    unsigned int getRowCount() const;
+    int getTile(unsigned int column, unsigned int row) const;
+    void setTile(unsigned int column, unsigned int row, int value);
+    void setTiles(const std::vector<int> &value);
+    const sf::Vector2i &getHoveredTile() const;
+    sf::Vector2i getTileCoordinates(const sf::Vector2i &point);
+
+    void setAlpha(float value) override;
+    float getWidth() override;
+    float getHeight() override;
+    sf::FloatRect getRect() override;
+
+    void drawToTarget(sf::RenderTarget &target) override;
+    void drawToList(DrawList &list) override;
+
+protected:
+    bool checkPointOnIt(const sf::Vector2i &point) override;
+
+private:
+    struct Chunk
+    {
+        sf::VertexArray vertices;
+        bool isChanged;
+    };
+
+    const sf::Texture &tileset;
+    const sf::Vector2u tileSize;
+    const unsigned int columnCount;
+    const unsigned int rowCount;
+    const unsigned int chunkColumnCount;
+    sf::Color color = sf::Color::White;
+    sf::Vector2i hoveredTile = sf::Vector2i(-1, -1);
+    sf::Transformable transformable;
+    std::vector<int> tiles;
+    std::vector<Chunk> chunks;
+
+    friend class BasicNode<TileMapNode, VisualNode>;
+
+    sf::Transformable &getBody() { return transformable; }
+    const sf::Transformable &getBody() const { return transformable; }
+    const sf::Drawable &getDrawable() const override;
+    sf::IntRect getVisibleChunks(const sf::View &view);
+    void buildChunk(unsigned int chunkColumn, unsigned int chunkRow);
+    void makeChunksChanged();
+};
+
+}
+
+#endif
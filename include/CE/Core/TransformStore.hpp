@@ -0,0 +1,44 @@
+#ifndef CE_TRANSFORMSTORE_HPP
+#define CE_TRANSFORMSTORE_HPP
+
+#include <SFML/Graphics/Transform.hpp>
+#include <vector>
+
+namespace ce {
+
+class TransformableNode;
+
+class TransformStore
+{
+public:
+    explicit TransformStore(TransformableNode &owner);
+    ~TransformStore();
+
+    const sf::Transform &getCombinedTransform(unsigned long index);
+    void setLocalTransform(unsigned long index, const sf::Transform &transform);
+
+    void build();
+    void invalidate();
+    void releaseNode(unsigned long index);
+
+private:
+    TransformableNode &owner;
+    bool isBuilt = false;
+    unsigned long checkedGeneration = 0;
+    bool isUpdated = false;
+    unsigned long checkedVersion = 0;
+    unsigned long checkedParentVersion = 0;
+
+    std::vector<TransformableNode *> nodes;
+    std::vector<long> parents;
+    std::vector<sf::Transform> localTransforms;
+    std::vector<sf::Transform> combinedTransforms;
+
+    void collect(TransformableNode &node, long parent);
+    bool checkChanged();
+    void update();
+};
+
+}
+
+#endif
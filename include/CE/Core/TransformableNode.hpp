@@ -2,13 +2,29 @@
 #define CE_TRANSFORMABLENODE_HPP
 
 #include <CE/Core/Node.hpp>
+#include <CE/Core/TransformStore.hpp>
 
 namespace ce {
 
-class TransformableNode : public Node
+enum class NodeKind : unsigned char { CUSTOM, MIMIC, RECTANGLE, CIRCLE, SPRITE, TEXT };
+
+// A virtual base is constructed by the most derived class only, so a subclass of a built-in node that
+// doesn't name its kind gets CUSTOM and Node keeps calling its hooks virtually.
+class NodeKindTag
+{
+protected:
+    explicit NodeKindTag(NodeKind kind = NodeKind::CUSTOM) : kind(kind) {}
+
+    const NodeKind kind;
+};
+
+class TransformableNode : public Node, protected virtual NodeKindTag
 {
 public:
+    using Kind = NodeKind;
+
     explicit TransformableNode(bool isSelectable = false);
+    ~TransformableNode() override;
 
     virtual float getWidth() = 0;
     virtual float getHeight() = 0;
@@ -30,6 +46,8 @@ public:
     void setY(float value);
     const sf::Vector2f &getPos() const;
 
+    static unsigned long getTransformGeneration();
+    unsigned long getTransformVersion() const;
     const sf::Transform &getCombinedTransform() override;
 
     virtual void setOrigin(float x, float y) = 0;
@@ -39,16 +57,32 @@ public:
     void moveY(float offset);
     virtual void move(float offsetX, float offsetY) = 0;
 
+    Kind getKind() const;
     void removeFromParent();
+    void enableTransformStore();
+    void disableTransformStore();
 
 protected:
     bool checkPointOnIt(const sf::Vector2i &point) override;
     sf::Vector2f translatePointToLocalCoordinates(const sf::Vector2i &point);
     void makeTransformed() override;
+    void makeRectChanged();
+    void onDescendantsChanged() override;
 
 private:
+    friend class Node;
+    friend class TransformStore;
+
+    static std::atomic<unsigned long> transformGeneration;
+
     bool isTransformed = true;
+    unsigned long transformVersion = 0;
+    unsigned long checkedGeneration = 0;
+    unsigned long parentVersion = 0;
     sf::Transform combinedTransform;
+    TransformStore *store = nullptr;
+    unsigned long storeIndex = 0;
+    std::unique_ptr<TransformStore> transformStore;
 
     virtual const sf::Transformable &getTransformable() const = 0;
 };
@@ -2,18 +2,41 @@
 #define CE_VISUALNODE_HPP
 
 #include <CE/Core/TransformableNode.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <memory>
 
 namespace ce {
 
 class VisualNode : public TransformableNode
 {
 public:
+    static constexpr unsigned long QUAD_VERTEX_COUNT = 6;
+
     explicit VisualNode(bool isSelectable = false);
+    ~VisualNode() override;
 
     virtual void setAlpha(float value) = 0;
     void drawToTarget(sf::RenderTarget &target) override;
+    void drawToList(DrawList &list) override;
+
+protected:
+    void makeChanged();
+    void collectBatched(BatchNode &batch) override;
+
+    virtual bool checkBatchable() const { return false; }
+    virtual const sf::Texture *getTexture() const { return nullptr; }
+    virtual unsigned long getVertexCount() const { return QUAD_VERTEX_COUNT; }
+    virtual void writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const {}
+    virtual std::unique_ptr<sf::Drawable> copyDrawable() const { return nullptr; }
+    static void fillQuad(sf::Vertex *quad, const sf::Transform &transform, const sf::FloatRect &rect,
+                         const sf::IntRect &textureRect, const sf::Color &color);
 
 private:
+    friend class BatchNode;
+
+    BatchNode *batch = nullptr;
+    unsigned long batchSlot = 0;
+
     virtual const sf::Drawable &getDrawable() const = 0;
 };
 
@@ -0,0 +1,17 @@
+#ifndef CE_EVENTID_HPP
+#define CE_EVENTID_HPP
+
+#include <string>
+
+namespace ce {
+
+typedef unsigned int EventId;
+
+constexpr EventId ANY_EVENT = static_cast<EventId>(-1);
+
+EventId registerEvent(const std::string &name);
+const std::string &getEventName(EventId event);
+
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef CE_EVENTQUEUE_HPP
+#define CE_EVENTQUEUE_HPP
+
+#include <CE/Event/EventId.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ce {
+
+class Speaker;
+
+class EventQueue
+{
+public:
+    static void post(const std::shared_ptr<Speaker> &speaker, EventId event);
+    static void flush();
+
+private:
+    struct Entry
+    {
+        std::weak_ptr<Speaker> speaker;
+        EventId event;
+    };
+
+    static std::vector<Entry> entries;
+    static std::vector<Entry> flushedEntries;
+    static std::mutex mutex;
+};
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef CE_RECEIVER_HPP
 #define CE_RECEIVER_HPP
 
-#include <SFML/System/String.hpp>
+#include <CE/Event/EventId.hpp>
 #include <memory>
 
 namespace ce {
@@ -11,7 +11,7 @@ class Speaker;
 class Listener
 {
 public:
-    virtual void onEvent(const std::shared_ptr<Speaker> &speaker, const sf::String &name) = 0;
+    virtual void onEvent(const std::shared_ptr<Speaker> &speaker, EventId event) = 0;
 };
 
 }
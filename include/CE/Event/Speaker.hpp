@@ -3,6 +3,7 @@
 
 #include <CE/Event/Listener.hpp>
 #include <CE/Utility/EnableSharedFromThis.hpp>
+#include <vector>
 
 namespace ce {
 
@@ -12,12 +13,26 @@ public:
     explicit Speaker(const std::shared_ptr<Listener> &listener = nullptr);
 
     void setListener(const std::shared_ptr<Listener> &value);
+    void addListener(const std::shared_ptr<Listener> &value, EventId event = ANY_EVENT);
+    void removeListener(const std::shared_ptr<Listener> &value);
 
 protected:
-    void declareEvent(const sf::String &name);
+    void declareEvent(EventId event);
+    void postEvent(EventId event);
 
 private:
-    std::weak_ptr<Listener> listener;
+    friend class EventQueue;
+
+    struct Subscriber
+    {
+        std::weak_ptr<Listener> listener;
+        EventId event;
+    };
+
+    std::vector<Subscriber> subscribers;
+    unsigned int dispatchDepth = 0;
+
+    void removeExpiredSubscribers();
 };
 
 }
@@ -0,0 +1,35 @@
+#ifndef CE_FONTHANDLE_HPP
+#define CE_FONTHANDLE_HPP
+
+#include <SFML/Graphics/Font.hpp>
+#include <memory>
+
+namespace ce {
+
+class FontHandle
+{
+public:
+    FontHandle();
+
+    bool checkLoaded() const;
+    bool checkFailed() const;
+    const sf::Font *getFont() const;
+
+private:
+    friend class ResourceManager;
+
+    struct Entry
+    {
+        bool isLoaded = false;
+        bool isFailed = false;
+        sf::Font font;
+    };
+
+    std::shared_ptr<Entry> entry;
+
+    explicit FontHandle(const std::shared_ptr<Entry> &entry);
+};
+
+}
+
+#endif
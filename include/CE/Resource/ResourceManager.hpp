@@ -0,0 +1,55 @@
+#ifndef CE_RESOURCEMANAGER_HPP
+#define CE_RESOURCEMANAGER_HPP
+
+#include <CE/Resource/FontHandle.hpp>
+#include <CE/Resource/TextureHandle.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ce {
+
+class ResourceManager
+{
+public:
+    static TextureHandle loadTexture(const std::string &filename, bool isPacked = true);
+    static FontHandle loadFont(const std::string &filename);
+    static unsigned long getPendingCount();
+    static void flush();
+    static void finishLoading();
+    static void releaseUnused();
+    // Held by a render thread while it draws a list; code that changes a texture a list may point to, such as
+    // an atlas page, a font page or a cached render texture, takes it first.
+    static std::recursive_mutex &getTextureMutex();
+
+private:
+    static constexpr unsigned int ATLAS_SIZE = 2048;
+    static constexpr unsigned int ATLAS_PADDING = 1;
+    static constexpr unsigned int PACKED_SIZE_LIMIT = 256;
+
+    struct AtlasPage
+    {
+        sf::Texture texture;
+        unsigned int size = 0;
+        unsigned int shelfX = 0;
+        unsigned int shelfY = 0;
+        unsigned int shelfHeight = 0;
+    };
+
+    class Loader;
+
+    static std::map<std::string, std::shared_ptr<TextureHandle::Entry> > textures;
+    static std::map<std::string, std::shared_ptr<FontHandle::Entry> > fonts;
+    static std::vector<std::unique_ptr<AtlasPage> > atlasPages;
+    static std::unique_ptr<Loader> loader;
+
+    static Loader &getLoader();
+    static void uploadTexture(TextureHandle::Entry &entry);
+    static bool packTexture(TextureHandle::Entry &entry);
+    static bool packIntoPage(AtlasPage &page, TextureHandle::Entry &entry);
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef CE_SCENE_HPP
+#define CE_SCENE_HPP
+
+#include <CE/Resource/SceneFile.hpp>
+#include <unordered_map>
+
+namespace ce {
+
+class Scene
+{
+public:
+    const std::shared_ptr<MimicNode> &getRoot() const;
+    unsigned long getNodeCount() const;
+    std::shared_ptr<TransformableNode> getNode(sf::Uint32 id) const;
+
+    void load(const SceneFile &file);
+    void removeNode(sf::Uint32 id);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<TransformableNode> node;
+        SceneFile::NodeRecord record;
+        sf::Uint32 parentId;
+        std::string texturePath;
+        sf::String text;
+        std::vector<sf::Uint32> childIds;
+        unsigned long loadVersion;
+    };
+
+    std::shared_ptr<MimicNode> root = std::make_shared<MimicNode>();
+    std::unordered_map<sf::Uint32, Entry> entries;
+    std::vector<sf::Uint32> rootIds;
+    unsigned long loadVersion = 0;
+
+    Node &getParentNode(sf::Uint32 parentId);
+    std::vector<sf::Uint32> &getChildIds(sf::Uint32 parentId);
+    void insertNode(const SceneFile &file, unsigned long index, sf::Uint32 parentId);
+    void replaceNode(const SceneFile &file, unsigned long index, Entry &entry);
+    void moveNode(sf::Uint32 id, Entry &entry, sf::Uint32 parentId);
+    bool applyChanges(const SceneFile &file, const SceneFile::NodeRecord &record, Entry &entry);
+    void detachNode(sf::Uint32 id, Entry &entry);
+};
+
+}
+
+#endif
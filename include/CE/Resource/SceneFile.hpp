@@ -0,0 +1,96 @@
+#ifndef CE_SCENEFILE_HPP
+#define CE_SCENEFILE_HPP
+
+#include <CE/Core/MimicNode.hpp>
+#include <CE/Resource/TextureHandle.hpp>
+#include <SFML/Config.hpp>
+#include <string>
+#include <vector>
+
+namespace ce {
+
+class NodePool;
+
+class SceneFile
+{
+public:
+    static constexpr sf::Uint32 MAGIC = 0x31534543;
+    static constexpr sf::Uint32 VERSION = 2;
+    static constexpr sf::Uint32 NO_RESOURCE = 0xFFFFFFFF;
+
+    enum class NodeType : sf::Uint8 { GROUP, SPRITE, RECTANGLE, CIRCLE, TEXT };
+
+    // Layout: Header, TextureRecord[textureCount], NodeRecord[nodeCount], char strings[stringSize].
+    // Nodes are stored breadth-first, so the children of every node form one contiguous range after it.
+    // Every node carries a nonzero id that stays stable across edits of the scene.
+    struct Header
+    {
+        sf::Uint32 magic;
+        sf::Uint32 version;
+        sf::Uint32 nodeCount;
+        sf::Uint32 rootCount;
+        sf::Uint32 textureCount;
+        sf::Uint32 stringSize;
+    };
+
+    struct TextureRecord
+    {
+        sf::Uint32 pathOffset;
+        sf::Uint32 pathLength;
+    };
+
+    struct NodeRecord
+    {
+        NodeType type;
+        sf::Uint8 isSelectable;
+        sf::Uint16 characterSize;
+        sf::Int32 zIndex;
+        sf::Uint32 id;
+        float x;
+        float y;
+        float originX;
+        float originY;
+        float rotation;
+        float scale;
+        float width;
+        float height;
+        sf::Uint32 color;
+        sf::Uint32 resource;
+        sf::Uint32 resourceLength;
+        sf::Uint32 firstChild;
+        sf::Uint32 childCount;
+    };
+
+    SceneFile() = default;
+    SceneFile(const SceneFile &) = delete;
+    SceneFile &operator=(const SceneFile &) = delete;
+    ~SceneFile();
+
+    bool open(const std::string &filename);
+    void close();
+    unsigned long getNodeCount() const;
+    unsigned long getRootCount() const;
+    const NodeRecord &getNode(unsigned long index) const;
+    std::string getTexturePath(unsigned long index) const;
+    sf::String getText(const NodeRecord &record) const;
+    std::shared_ptr<TransformableNode> createNode(unsigned long index) const;
+    std::vector<std::shared_ptr<TransformableNode> > createNodes() const;
+    std::shared_ptr<MimicNode> instantiate() const;
+
+private:
+    const char *data = nullptr;
+    std::size_t size = 0;
+    std::vector<char> buffer;
+
+    const Header &getHeader() const;
+    const TextureRecord *getTextures() const;
+    const NodeRecord *getNodes() const;
+    const char *getStrings() const;
+    bool checkValid() const;
+    std::shared_ptr<TransformableNode> createNode(const NodeRecord &record, const NodePool *pool,
+                                                  const TextureHandle &texture) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef CE_SCENEWRITER_HPP
+#define CE_SCENEWRITER_HPP
+
+#include <CE/Resource/SceneFile.hpp>
+
+namespace ce {
+
+class SceneWriter
+{
+public:
+    unsigned long addTexture(const std::string &filename);
+    unsigned long addNode(SceneFile::NodeType type, long parent = -1);
+    SceneFile::NodeRecord &getNode(unsigned long index);
+    void setText(unsigned long index, const std::string &value);
+    bool save(const std::string &filename) const;
+
+private:
+    std::vector<std::string> textures;
+    std::vector<SceneFile::NodeRecord> nodes;
+    std::vector<long> parents;
+    std::vector<std::string> texts;
+};
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef CE_TEXTUREHANDLE_HPP
+#define CE_TEXTUREHANDLE_HPP
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <memory>
+
+namespace ce {
+
+class TextureHandle
+{
+public:
+    TextureHandle();
+
+    bool checkLoaded() const;
+    bool checkFailed() const;
+    const sf::Texture *getTexture() const;
+    const sf::IntRect &getTextureRect() const;
+
+private:
+    friend class ResourceManager;
+
+    struct Entry
+    {
+        bool isPacked = true;
+        bool isLoaded = false;
+        bool isFailed = false;
+        sf::Image image;
+        std::unique_ptr<sf::Texture> ownTexture;
+        const sf::Texture *texture = nullptr;
+        sf::IntRect textureRect;
+    };
+
+    std::shared_ptr<Entry> entry;
+
+    explicit TextureHandle(const std::shared_ptr<Entry> &entry);
+};
+
+}
+
+#endif
@@ -34,8 +34,9 @@ private:
 
     std::shared_ptr<Text> text = std::make_shared<Text>("", 18, sf::Color::White);
     sf::Vector2f size;
+    State state = State::DEFAULT;
 
-    void setState(State state);
+    void setState(State value);
 };
 
 }
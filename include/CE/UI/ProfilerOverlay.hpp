@@ -0,0 +1,24 @@
+#ifndef CE_PROFILEROVERLAY_HPP
+#define CE_PROFILEROVERLAY_HPP
+
+#include <CE/UI/Text.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace ce {
+
+class ProfilerOverlay : public Text
+{
+public:
+    explicit ProfilerOverlay(const sf::Time &refreshInterval = sf::seconds(0.5f),
+                             const sf::Color &color = sf::Color::White);
+
+private:
+    const sf::Time refreshInterval;
+    sf::Clock refreshClock;
+
+    void onUpdated() override;
+};
+
+}
+
+#endif
@@ -16,6 +16,7 @@ public:
 
     void setMinimum(float minimum);
     void setMaximum(float maximum);
+    float getValue() const;
     void setValue(float value);
 
 private:
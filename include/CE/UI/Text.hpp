@@ -1,43 +1,63 @@
 #ifndef CE_TEXT_HPP
 #define CE_TEXT_HPP
 
+#include <CE/Core/BasicNode.hpp>
 #include <CE/Core/VisualNode.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <vector>
 
 namespace ce {
 
-class Text : public VisualNode
+class Text : public BasicNode<Text, VisualNode>
 {
 public:
+    static constexpr unsigned int CHARACTER_SIZE = 18;
+
     static void loadFont(const std::string &filename);
+    static const sf::Font &getDefaultFont();
     explicit Text(const sf::String &string = "", unsigned int characterSize = CHARACTER_SIZE,
                   const sf::Color &color = sf::Color::Black);
 
     const sf::String &getString() const;
     void setString(const sf::String &value);
+    const sf::Font &getFont() const;
+    void setFont(const sf::Font &value);
     void setAlpha(float value) override;
 
     float getWidth() override;
     float getHeight() override;
-    void setScale(float value) override;
     sf::FloatRect getRect() override;
-    void setRotation(float value) override;
 
     void setOrigin(float x, float y) override;
     void setPos(float x, float y) override;
-    void rotate(float angle) override;
     void move(float offsetX, float offsetY) override;
 
     virtual void resize();
 
+protected:
+    void update() override;
+    bool checkBatchable() const override;
+    const sf::Texture *getTexture() const override;
+    unsigned long getVertexCount() const override;
+    void writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const override;
+
 private:
-    static constexpr unsigned int CHARACTER_SIZE = 18;
     static sf::Font font;
 
     const unsigned int characterSize;
     sf::Text text;
+    sf::FloatRect bounds;
+    std::vector<sf::Vertex> glyphVertices;
+    sf::String pendingString;
+    bool isLayoutPending = false;
+
+    friend class BasicNode<Text, VisualNode>;
+    friend class Node;
 
-    const sf::Transformable &getTransformable() const override;
+    sf::Text &getBody() { return text; }
+    const sf::Text &getBody() const { return text; }
+    void updateLayout();
+    void applyPendingString();
     const sf::Drawable &getDrawable() const override;
 };
 
@@ -18,14 +18,14 @@ public:
 template <typename T>
 std::shared_ptr<T> EnableSharedFromThis<T>::sharedFromThis()
 {
-    return std::dynamic_pointer_cast<T>(shared_from_this());
+    return std::shared_ptr<T>(shared_from_this(), static_cast<T *>(this));
 }
 
 template <typename T>
 template <typename U>
 std::shared_ptr<U> EnableSharedFromThis<T>::castSharedFromThis()
 {
-    return std::dynamic_pointer_cast<U>(shared_from_this());
+    return std::shared_ptr<U>(shared_from_this(), static_cast<U *>(static_cast<T *>(this)));
 }
 
 }
@@ -0,0 +1,63 @@
+#ifndef CE_JOBPOOL_HPP
+#define CE_JOBPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ce {
+
+class JobPool
+{
+public:
+    static JobPool &getShared();
+    explicit JobPool(unsigned int threadCount = std::thread::hardware_concurrency());
+    ~JobPool();
+
+    unsigned int getThreadCount() const;
+    void run(unsigned long count, const std::function<void(unsigned long)> &job);
+
+private:
+    static constexpr unsigned long CHUNKS_PER_THREAD = 4;
+
+    struct Batch
+    {
+        const std::function<void(unsigned long)> *job;
+        std::atomic<unsigned long> remainingCount;
+    };
+
+    struct Task
+    {
+        Batch *batch;
+        unsigned long first;
+        unsigned long last;
+    };
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker> > workers;
+    std::atomic<unsigned long> queuedCount;
+    bool isStopped = false;
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    void work(unsigned long index);
+    bool findTask(unsigned long index, Task &task);
+    void execute(const Task &task);
+};
+
+}
+
+#endif
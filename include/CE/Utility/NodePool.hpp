@@ -0,0 +1,70 @@
+#ifndef CE_NODEPOOL_HPP
+#define CE_NODEPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+
+namespace ce {
+
+// Copies share one storage. Allocation and release are locked, so pooled nodes may be created on a loading thread
+// and released on whichever thread drops the last reference.
+class NodePool
+{
+public:
+    explicit NodePool(unsigned long blocksPerChunk = 64);
+
+    unsigned long getBlockCount() const;
+    unsigned long getFreeBlockCount() const;
+
+    void *allocate(std::size_t size) const;
+    void deallocate(void *block, std::size_t size) const;
+
+    bool operator==(const NodePool &other) const;
+    bool operator!=(const NodePool &other) const;
+
+private:
+    struct Storage;
+    std::shared_ptr<Storage> storage;
+};
+
+template <typename T>
+class PoolAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit PoolAllocator(const NodePool &pool) : pool(pool) {}
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &other) : pool(other.getPool()) {}
+
+    const NodePool &getPool() const { return pool; }
+    T *allocate(std::size_t count) { return static_cast<T *>(pool.allocate(count * sizeof(T))); }
+    void deallocate(T *pointer, std::size_t count) { pool.deallocate(pointer, count * sizeof(T)); }
+
+private:
+    NodePool pool;
+};
+
+template <typename T, typename U>
+inline bool operator==(const PoolAllocator<T> &left, const PoolAllocator<U> &right)
+{
+    return left.getPool() == right.getPool();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const PoolAllocator<T> &left, const PoolAllocator<U> &right)
+{
+    return left.getPool() != right.getPool();
+}
+
+template <typename T, typename... Args>
+inline std::shared_ptr<T> createPooled(const NodePool &pool, Args &&...args)
+{
+    auto instance = std::allocate_shared<T>(PoolAllocator<T>(pool), std::forward<Args>(args)...);
+    instance->onCreated();
+    return instance;
+}
+
+}
+
+#endif
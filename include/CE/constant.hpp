@@ -1,12 +1,14 @@
 #ifndef CE_CONSTANT_HPP
 #define CE_CONSTANT_HPP
 
+#include <CE/Event/EventId.hpp>
+
 namespace ce {
 
 constexpr unsigned int INDENT = 20;
 constexpr float MATH_PI = 3.141592654f;
 
-const sf::String CLICK = "click";
+constexpr EventId CLICK = 0;
 
 }
 
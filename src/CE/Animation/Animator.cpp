@@ -0,0 +1,160 @@
+#include <CE/Animation/Animator.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/VisualNode.hpp>
+#include <CE/UI/ProgressBar.hpp>
+#include <algorithm>
+#include <iterator>
+
+namespace ce {
+
+void Animator::moveTo(const std::shared_ptr<TransformableNode> &node, const sf::Vector2f &position,
+                      const sf::Time &duration, Easing easing)
+{
+    add(node, X, node->getX(), position.x, duration, easing);
+    add(node, Y, node->getY(), position.y, duration, easing);
+}
+
+void Animator::rotateTo(const std::shared_ptr<TransformableNode> &node, float rotation,
+                        const sf::Time &duration, Easing easing)
+{
+    add(node, ROTATION, node->getRotation(), rotation, duration, easing);
+}
+
+void Animator::scaleTo(const std::shared_ptr<TransformableNode> &node, float scale,
+                       const sf::Time &duration, Easing easing)
+{
+    add(node, SCALE, node->getScale(), scale, duration, easing);
+}
+
+void Animator::fade(const std::shared_ptr<VisualNode> &node, float from, float to,
+                    const sf::Time &duration, Easing easing)
+{
+    add(node, ALPHA, from, to, duration, easing);
+}
+
+void Animator::fillTo(const std::shared_ptr<ProgressBar> &bar, float value,
+                      const sf::Time &duration, Easing easing)
+{
+    add(bar, VALUE, bar->getValue(), value, duration, easing);
+}
+
+bool Animator::checkAnimated(const TransformableNode &node) const
+{
+    return std::any_of(tweens.begin(), tweens.end(), [&node](const Tween &tween) -> bool {
+        return tween.key == &node;
+    });
+}
+
+void Animator::stop(const TransformableNode &node)
+{
+    tweens.erase(std::remove_if(tweens.begin(), tweens.end(), [&node](const Tween &tween) -> bool {
+        return tween.key == &node;
+    }), tweens.end());
+}
+
+void Animator::advance(const sf::Time &elapsed)
+{
+    if (tweens.empty()) {
+        return;
+    }
+    if (!isSorted) {
+        std::stable_sort(tweens.begin(), tweens.end(), [](const Tween &left, const Tween &right) -> bool {
+            return std::less<TransformableNode *>()(left.key, right.key);
+        });
+        isSorted = true;
+    }
+
+    const float seconds = elapsed.asSeconds();
+    for (unsigned long first = 0; first < tweens.size();) {
+        first = advanceNode(first, seconds);
+    }
+    tweens.erase(std::remove_if(tweens.begin(), tweens.end(), [](const Tween &tween) -> bool {
+        return tween.elapsed >= tween.duration;
+    }), tweens.end());
+}
+
+void Animator::add(const std::shared_ptr<TransformableNode> &node, Property property, float from, float to,
+                   const sf::Time &duration, Easing easing)
+{
+    if (!tweens.empty() && std::less<TransformableNode *>()(node.get(), tweens.back().key)) {
+        isSorted = false;
+    }
+    tweens.push_back({ node.get(), node, property, easing, from, to, 0, duration.asSeconds() });
+}
+
+float Animator::ease(Easing easing, float progress)
+{
+    if (easing == Easing::EASE_IN) {
+        return progress * progress;
+    } else if (easing == Easing::EASE_OUT) {
+        return progress * (2 - progress);
+    } else if (easing == Easing::EASE_IN_OUT) {
+        return progress < 0.5f ? 2 * progress * progress : -1 + (4 - 2 * progress) * progress;
+    }
+    return progress;
+}
+
+unsigned long Animator::advanceNode(unsigned long first, float elapsed)
+{
+    unsigned long last = first;
+    while (last < tweens.size() && tweens[last].key == tweens[first].key) {
+        last++;
+    }
+
+    const std::shared_ptr<TransformableNode> node = tweens[first].node.lock();
+    Tween *latest[PROPERTY_COUNT] = {};
+    for (unsigned long i = first; i < last; i++) {
+        Tween &tween = tweens[i];
+        const bool isSameNode = !tween.node.owner_before(tweens[first].node)
+                                && !tweens[first].node.owner_before(tween.node);
+        if (!node || !isSameNode) {
+            tween.elapsed = tween.duration;
+            continue;
+        }
+        if (latest[tween.property]) {
+            latest[tween.property]->elapsed = latest[tween.property]->duration;
+        }
+        latest[tween.property] = &tween;
+        tween.elapsed = std::min(tween.elapsed + elapsed, tween.duration);
+    }
+    if (!node) {
+        return last;
+    }
+    if (!FrameBudget::getCurrent().checkDue(*node) && !node->checkOnScreen()) {
+        // Off-screen nodes under load only catch up on their due frames or when a tween finishes.
+        const bool isFinishing = std::any_of(std::begin(latest), std::end(latest), [](const Tween *tween) -> bool {
+            return tween && tween->elapsed >= tween->duration;
+        });
+        if (!isFinishing) {
+            return last;
+        }
+    }
+
+    float values[PROPERTY_COUNT];
+    for (unsigned long i = 0; i < PROPERTY_COUNT; i++) {
+        if (latest[i]) {
+            const Tween &tween = *latest[i];
+            const float progress = tween.duration > 0 ? tween.elapsed / tween.duration : 1;
+            values[i] = tween.from + (tween.to - tween.from) * ease(tween.easing, progress);
+        }
+    }
+
+    if (latest[X] || latest[Y]) {
+        node->setPos(latest[X] ? values[X] : node->getX(), latest[Y] ? values[Y] : node->getY());
+    }
+    if (latest[ROTATION]) {
+        node->setRotation(values[ROTATION]);
+    }
+    if (latest[SCALE]) {
+        node->setScale(values[SCALE]);
+    }
+    if (latest[ALPHA]) {
+        static_cast<VisualNode *>(node.get())->setAlpha(values[ALPHA]);
+    }
+    if (latest[VALUE]) {
+        static_cast<ProgressBar *>(node.get())->setValue(values[VALUE]);
+    }
+    return last;
+}
+
+}
@@ -1,26 +1,33 @@
 #include <CE/Core/Act.hpp>
+#include <CE/Core/DrawList.hpp>
 #include <CE/constant.hpp>
-#include <SFML/Window/Mouse.hpp>
+#include <algorithm>
 
 namespace ce {
 
-Act::Act(Mode contentMode, Stage &stage, const sf::Color &bgColor)
-    : bgColor(bgColor), contentMode(contentMode), savedMousePosition(sf::Mouse::getPosition(stage)), stage(stage) {}
+Act::Act(Mode contentMode, BaseStage &stage, const sf::Color &bgColor)
+    : bgColor(bgColor), contentMode(contentMode), savedMousePosition(stage.getMousePosition()), stage(stage) {}
 
 void Act::onMouseMoved(const sf::Vector2i &mousePosition)
 {
-    std::shared_ptr<Node> newSelectedNode = select(mousePosition);
-    if (selectedNode != newSelectedNode) {
-        if (selectedNode) {
-            selectedNode->onMouseLeft();
-        }
-        selectedNode = newSelectedNode;
-        if (selectedNode) {
-            selectedNode->onMouseEntered();
+    const std::shared_ptr<Camera> camera = findCamera(mousePosition);
+    const sf::Vector2i point = camera ? camera->mapPixel(mousePosition, stage.getSize()) : mousePosition;
+    if (camera != selectedCamera || !checkSelectionCached(point)) {
+        Node *newSelectedNode = camera ? selectInChild(*camera->getContent(), point) : select(point);
+        if (selectedNode.get() != newSelectedNode) {
+            if (selectedNode) {
+                selectedNode->onMouseLeft();
+            }
+            selectedNode = newSelectedNode ? newSelectedNode->sharedFromThis() : nullptr;
+            if (selectedNode) {
+                selectedNode->onMouseEntered();
+            }
         }
+        selectedCamera = camera;
+        cacheSelection();
     }
     if (selectedNode) {
-        selectedNode->onMouseMoved(mousePosition);
+        selectedNode->onMouseMoved(point);
     }
 
     if (contentMode == Mode::MOVABLE_BY_MOUSE) {
@@ -98,11 +105,16 @@ const sf::Transform &Act::getCombinedTransform()
     return mockTransform;
 }
 
-const sf::Window &Act::getWindow() const
+BaseStage &Act::getStage() const
 {
     return stage;
 }
 
+float Act::getInterpolation() const
+{
+    return stage.getInterpolation();
+}
+
 void Act::setCenter(const std::shared_ptr<TransformableNode> &value)
 {
     center = value;
@@ -151,6 +163,20 @@ void Act::setOverlayUi(const std::shared_ptr<TransformableNode> &value)
     overlayUi = value;
 }
 
+void Act::addCamera(const std::shared_ptr<Camera> &camera)
+{
+    cameras.push_back(camera);
+}
+
+void Act::removeCamera(const std::shared_ptr<Camera> &camera)
+{
+    cameras.erase(std::remove(cameras.begin(), cameras.end(), camera), cameras.end());
+    if (selectedCamera == camera) {
+        selectedCamera.reset();
+        isSelectionCacheable = false;
+    }
+}
+
 void Act::setUpNodes()
 {
     resizeUi();
@@ -158,27 +184,33 @@ void Act::setUpNodes()
     const float fullTopIndent = topUi ? topUi->getHeight() : 0;
 
     if (leftUi) {
-        leftUi->setY(fullTopIndent);
+        placeNode(*leftUi, leftUi->getX(), fullTopIndent);
     }
     float freeWidth = stage.getSize().x - fullLeftIndent;
     if (rightUi) {
-        rightUi->setPos(stage.getSize().x - rightUi->getWidth(), fullTopIndent);
+        placeNode(*rightUi, stage.getSize().x - rightUi->getWidth(), fullTopIndent);
         freeWidth -= rightUi->getWidth();
     }
 
     if (topUi) {
-        topUi->setX(fullLeftIndent);
+        placeNode(*topUi, fullLeftIndent, topUi->getY());
     }
     float freeHeight = stage.getSize().y - fullTopIndent;
     if (bottomUi) {
-        bottomUi->setPos(fullLeftIndent, stage.getSize().y - bottomUi->getHeight());
+        placeNode(*bottomUi, fullLeftIndent, stage.getSize().y - bottomUi->getHeight());
         freeHeight -= bottomUi->getHeight();
     }
 
     if (contentMode == Mode::STATIC) {
-        contentLayer->setScale(std::min(freeWidth / contentLayer->getWidth(), freeHeight / contentLayer->getHeight()));
-        contentLayer->setOrigin(contentLayer->getHalfX(), contentLayer->getHalfY());
-        contentLayer->setPos(fullLeftIndent + freeWidth / 2, fullTopIndent + freeHeight / 2);
+        const float scale = std::min(freeWidth / contentLayer->getWidth(), freeHeight / contentLayer->getHeight());
+        if (contentLayer->getScale() != scale) {
+            contentLayer->setScale(scale);
+        }
+        if (contentLayer->getOriginX() != contentLayer->getHalfX()
+            || contentLayer->getOriginY() != contentLayer->getHalfY()) {
+            contentLayer->setOrigin(contentLayer->getHalfX(), contentLayer->getHalfY());
+        }
+        placeNode(*contentLayer, fullLeftIndent + freeWidth / 2, fullTopIndent + freeHeight / 2);
     }
 }
 
@@ -204,8 +236,34 @@ void Act::update()
         sf::Vector2f offset = center->getCombinedTransform().transformPoint(0, 0);
         contentLayer->move(stage.getSize().x / 2 - offset.x, stage.getSize().y / 2 - offset.y);
     }
+}
 
-    drawToTarget(stage);
+void Act::draw(sf::RenderTarget &target)
+{
+    drawToTarget(target);
+    if (cameras.empty()) {
+        return;
+    }
+    const sf::View view = target.getView();
+    for (auto &camera : cameras) {
+        target.setView(camera->getView(target.getSize()));
+        drawChildToTarget(*camera->getContent(), target);
+    }
+    target.setView(view);
+}
+
+void Act::draw(DrawList &list)
+{
+    drawToList(list);
+    if (cameras.empty()) {
+        return;
+    }
+    const sf::View view = list.getView();
+    for (auto &camera : cameras) {
+        list.setView(camera->getView(stage.getSize()));
+        drawChildToList(*camera->getContent(), list);
+    }
+    list.setView(view);
 }
 
 bool Act::checkPointOnIt(const sf::Vector2i &point)
@@ -213,9 +271,41 @@ bool Act::checkPointOnIt(const sf::Vector2i &point)
     return point.x > 0 && point.x < stage.getSize().x && point.y > 0 && point.y < stage.getSize().y;
 }
 
-void Act::declareEvent(const sf::String &name)
+void Act::declareEvent(EventId event)
+{
+    stage.onEvent(castSharedFromThis<Act>(), event);
+}
+
+std::shared_ptr<Camera> Act::findCamera(const sf::Vector2i &mousePosition) const
 {
-    stage.onEvent(castSharedFromThis<Act>(), name);
+    for (auto it = cameras.rbegin(); it != cameras.rend(); it++) {
+        if ((*it)->checkPixelInViewport(mousePosition, stage.getSize())) {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+bool Act::checkSelectionCached(const sf::Vector2i &mousePosition)
+{
+    return isSelectionCacheable && selectedNode
+        && selectionHitTestGeneration == getHitTestGeneration()
+        && selectionPathStamp == getHitPathStamp(*selectedNode)
+        && checkStillHit(*selectedNode, mousePosition);
+}
+
+void Act::cacheSelection()
+{
+    isSelectionCacheable = selectedNode && checkHitCacheable(*selectedNode);
+    selectionHitTestGeneration = getHitTestGeneration();
+    selectionPathStamp = isSelectionCacheable ? getHitPathStamp(*selectedNode) : 0;
+}
+
+void Act::placeNode(TransformableNode &node, float x, float y)
+{
+    if (node.getX() != x || node.getY() != y) {
+        node.setPos(x, y);
+    }
 }
 
 void Act::updateUi(const std::shared_ptr<TransformableNode> &oldUi, const std::shared_ptr<TransformableNode> &newUi)
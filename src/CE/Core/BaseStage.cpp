@@ -0,0 +1,206 @@
+#include <CE/Core/BaseStage.hpp>
+#include <CE/Core/Act.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Event/EventQueue.hpp>
+#include <CE/Resource/ResourceManager.hpp>
+
+namespace ce {
+
+void BaseStage::setAct(const std::shared_ptr<Act> &value)
+{
+    act = value;
+}
+
+const std::shared_ptr<Act> &BaseStage::getAct() const
+{
+    return act;
+}
+
+const sf::Time &BaseStage::getUpdateInterval() const
+{
+    return updateInterval;
+}
+
+void BaseStage::setUpdateInterval(const sf::Time &value)
+{
+    updateInterval = value;
+    lag = sf::Time::Zero;
+    interpolation = 0;
+}
+
+float BaseStage::getInterpolation() const
+{
+    return interpolation;
+}
+
+const sf::Time &BaseStage::getTickTime() const
+{
+    return tickTime;
+}
+
+Animator &BaseStage::getAnimator()
+{
+    return animator;
+}
+
+Input &BaseStage::getInput()
+{
+    return input;
+}
+
+FrameBudget &BaseStage::getFrameBudget()
+{
+    return frameBudget;
+}
+
+sf::Vector2i BaseStage::getMousePosition() const
+{
+    return input.getMousePosition();
+}
+
+sf::RenderTarget *BaseStage::getRenderTarget()
+{
+    return nullptr;
+}
+
+void BaseStage::pushEvent(const sf::Event &event)
+{
+    pushedEvents.push_back(event);
+}
+
+void BaseStage::start()
+{
+    isStopped = false;
+    clock.restart();
+    while (checkRunning()) {
+        update();
+    }
+    stopRendering();
+}
+
+void BaseStage::stop()
+{
+    isStopped = true;
+}
+
+void BaseStage::update()
+{
+    Profiler::startFrame(profiler);
+    if (frameBudget.startFrame(Profiler::getLastFrame().getWorkTime())) {
+        onQualityChanged(frameBudget.getQuality());
+    }
+    onUpdated();
+    prepareFrame();
+
+    input.startFrame();
+    bool isResized = false;
+    sf::Vector2u size;
+    bool isMouseMoved = false;
+    auto event = sf::Event();
+    while (pollInputEvent(event)) {
+        if (event.type == sf::Event::MouseMoved) {
+            input.moveMouse(sf::Vector2i(event.mouseMove.x, event.mouseMove.y));
+            isMouseMoved = true;
+            continue;
+        }
+        if (isMouseMoved) {
+            act->onMouseMoved(input.getMousePosition());
+            isMouseMoved = false;
+        }
+
+        if (event.type == sf::Event::Resized) {
+            size = sf::Vector2u(event.size.width, event.size.height);
+            isResized = true;
+        } else if (event.type == sf::Event::MouseLeft) {
+            act->onMouseLeft();
+        } else if (event.type == sf::Event::MouseButtonPressed) {
+            if (event.mouseButton.button == sf::Mouse::Left) {
+                act->onLeftMouseButtonPressed();
+            } else if (event.mouseButton.button == sf::Mouse::Right) {
+                act->onRightMouseButtonPressed();
+            }
+        } else if (event.type == sf::Event::MouseButtonReleased) {
+            if (event.mouseButton.button == sf::Mouse::Left) {
+                act->onLeftMouseButtonReleased();
+            } else if (event.mouseButton.button == sf::Mouse::Right) {
+                act->onRightMouseButtonReleased();
+            }
+        } else if (event.type == sf::Event::KeyPressed) {
+            if (input.pressKey(event.key.code)) {
+                act->onKeyPressed(event.key.code);
+            }
+        } else if (event.type == sf::Event::KeyReleased) {
+            input.releaseKey(event.key.code);
+            act->onKeyReleased(event.key.code);
+        } else if (event.type == sf::Event::LostFocus) {
+            input.releaseKeys();
+        } else if (event.type == sf::Event::Closed) {
+            onClosed();
+        }
+    }
+    if (isMouseMoved) {
+        act->onMouseMoved(input.getMousePosition());
+    }
+    if (isResized) {
+        onResized(size);
+        act->setUpNodes();
+    }
+    EventQueue::flush();
+    ResourceManager::flush();
+    Profiler::finishPhase(Profiler::Phase::EVENTS);
+
+    const sf::Time elapsed = getElapsedTime();
+    if (updateInterval == sf::Time::Zero) {
+        tickTime = elapsed;
+        animator.advance(elapsed);
+        act->update();
+    } else {
+        tickTime = updateInterval;
+        lag = std::min(lag + elapsed, updateInterval * (float) MAX_UPDATES_PER_FRAME);
+        while (lag >= updateInterval) {
+            animator.advance(updateInterval);
+            act->update();
+            lag -= updateInterval;
+        }
+        interpolation = lag / updateInterval;
+    }
+    Profiler::finishPhase(Profiler::Phase::UPDATE);
+
+    if (checkRunning()) {
+        drawFrame();
+    }
+}
+
+bool BaseStage::checkRunning() const
+{
+    return !isStopped;
+}
+
+bool BaseStage::pollInputEvent(sf::Event &event)
+{
+    if (pushedEvents.empty()) {
+        return false;
+    }
+    event = pushedEvents.front();
+    pushedEvents.pop_front();
+    return true;
+}
+
+void BaseStage::onClosed()
+{
+    stop();
+}
+
+sf::Time BaseStage::getElapsedTime()
+{
+    return clock.restart();
+}
+
+void BaseStage::drawFrame()
+{
+    Profiler::finishPhase(Profiler::Phase::DRAW);
+    Profiler::finishPhase(Profiler::Phase::DISPLAY);
+}
+
+}
@@ -0,0 +1,186 @@
+#include <CE/Core/BatchNode.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Core/VisualNode.hpp>
+
+namespace ce {
+
+BatchNode::BatchNode(bool isSelectable) : MimicNode(isSelectable) {}
+
+BatchNode::~BatchNode()
+{
+    for (auto &slot : slots) {
+        if (slot.node) {
+            slot.node->batch = nullptr;
+        }
+    }
+}
+
+void BatchNode::drawToTarget(sf::RenderTarget &target)
+{
+    prepareLayers();
+    sf::RenderStates states(getCombinedTransform());
+    for (auto &layer : layers) {
+        states.texture = layer.texture;
+        target.draw(layer.vertices, states);
+        Profiler::countDrawCall();
+    }
+
+    isDrawing = true;
+    MimicNode::drawToTarget(target);
+    isDrawing = false;
+}
+
+void BatchNode::drawToList(DrawList &list)
+{
+    prepareLayers();
+    for (auto &layer : layers) {
+        list.addVertices(layer.vertices, layer.texture, getCombinedTransform());
+    }
+
+    isDrawing = true;
+    MimicNode::drawToList(list);
+    isDrawing = false;
+}
+
+void BatchNode::onDescendantsChanged()
+{
+    isRebuildNeeded = true;
+    MimicNode::onDescendantsChanged();
+}
+
+void BatchNode::addSlot(VisualNode &node)
+{
+    if (node.batch && node.batch != this) {
+        node.batch->releaseSlot(node.batchSlot);
+    }
+
+    const sf::Texture *texture = node.getTexture();
+    auto layerIt = std::find_if(layers.begin(), layers.end(), [texture](const Layer &layer) -> bool {
+        return layer.texture == texture;
+    });
+    if (layerIt == layers.end()) {
+        layers.push_back({ texture, sf::VertexArray(sf::Triangles) });
+        layerIt = layers.end() - 1;
+    }
+
+    node.batch = this;
+    node.batchSlot = slots.size();
+    const unsigned long vertexIndex = layerIt->vertices.getVertexCount();
+    const unsigned long vertexCount = node.getVertexCount();
+    layerIt->vertices.resize(vertexIndex + vertexCount);
+    slots.push_back({ &node, static_cast<unsigned long>(layerIt - layers.begin()), vertexIndex, vertexCount, 0, false });
+    makeSlotChanged(node.batchSlot);
+}
+
+void BatchNode::releaseSlot(unsigned long index)
+{
+    slots[index].node = nullptr;
+    makeSlotChanged(index);
+}
+
+void BatchNode::makeSlotChanged(unsigned long index)
+{
+    if (!slots[index].isChanged) {
+        slots[index].isChanged = true;
+        changedSlots.push_back(index);
+    }
+}
+
+void BatchNode::deferSlotChange(unsigned long index)
+{
+    // Workers of a parallel update only flag their own slots; the list is rebuilt on the main thread.
+    slots[index].isChanged = true;
+    isSlotChangePending = true;
+}
+
+void BatchNode::collectDeferredSlots()
+{
+    isSlotChangePending = false;
+    changedSlots.clear();
+    for (unsigned long i = 0; i < slots.size(); i++) {
+        if (slots[i].isChanged) {
+            changedSlots.push_back(i);
+        }
+    }
+}
+
+unsigned long BatchNode::getTransformStamp(const VisualNode &node) const
+{
+    // Quads are stored relative to the batch, so only the nodes between the batch and the quad matter.
+    unsigned long stamp = 0;
+    for (const Node *current = &node; current != this; current = current->getParent()) {
+        stamp += static_cast<const TransformableNode *>(current)->getTransformVersion();
+    }
+    return stamp;
+}
+
+void BatchNode::prepareLayers()
+{
+    if (isRebuildNeeded) {
+        rebuild();
+    }
+    if (isSlotChangePending) {
+        collectDeferredSlots();
+    }
+    if (checkedTransformVersion != getDescendantsTransformVersion()) {
+        findTransformedSlots();
+    }
+    updateChangedSlots();
+}
+
+void BatchNode::rebuild()
+{
+    isRebuildNeeded = false;
+    for (auto &slot : slots) {
+        if (slot.node) {
+            slot.node->batch = nullptr;
+        }
+    }
+    slots.clear();
+    layers.clear();
+    changedSlots.clear();
+    Node::collectBatched(*this);
+}
+
+void BatchNode::findTransformedSlots()
+{
+    checkedTransformVersion = getDescendantsTransformVersion();
+    for (unsigned long i = 0; i < slots.size(); i++) {
+        if (slots[i].node && slots[i].transformStamp != getTransformStamp(*slots[i].node)) {
+            makeSlotChanged(i);
+        }
+    }
+}
+
+void BatchNode::updateChangedSlots()
+{
+    if (changedSlots.empty()) {
+        return;
+    }
+    for (auto index : changedSlots) {
+        if (slots[index].node && slots[index].node->getVertexCount() != slots[index].vertexCount) {
+            rebuild();
+            break;
+        }
+    }
+
+    const sf::Transform inverseTransform = getCombinedTransform().getInverse();
+    for (auto index : changedSlots) {
+        Slot &slot = slots[index];
+        slot.isChanged = false;
+        if (slot.vertexCount == 0) {
+            continue;
+        }
+        sf::Vertex *vertices = &layers[slot.layer].vertices[slot.vertexIndex];
+        if (slot.node) {
+            slot.transformStamp = getTransformStamp(*slot.node);
+            slot.node->writeVertices(vertices, inverseTransform * slot.node->getParent()->getCombinedTransform());
+        } else {
+            std::fill(vertices, vertices + slot.vertexCount, sf::Vertex());
+        }
+    }
+    changedSlots.clear();
+}
+
+}
@@ -0,0 +1,89 @@
+#include <CE/Core/CachedNode.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Resource/ResourceManager.hpp>
+#include <cmath>
+
+namespace ce {
+
+CachedNode::CachedNode(bool isSelectable) : MimicNode(isSelectable)
+{
+    isCaching = true;
+}
+
+void CachedNode::drawToTarget(sf::RenderTarget &target)
+{
+    prepareCache();
+    target.draw(sprite, getSpriteTransform());
+    Profiler::countDrawCall();
+}
+
+void CachedNode::drawToList(DrawList &list)
+{
+    prepareCache();
+    if (sprite.getTexture()) {
+        list.addDrawable(std::unique_ptr<sf::Drawable>(new sf::Sprite(sprite)), getSpriteTransform());
+    }
+}
+
+void CachedNode::onDescendantsChanged()
+{
+    isCacheValid = false;
+    MimicNode::onDescendantsChanged();
+}
+
+void CachedNode::prepareCache()
+{
+    const unsigned long stamp = getDescendantsTransformVersion() + getDescendantsChangeVersion();
+    if (stamp != descendantsStamp) {
+        descendantsStamp = stamp;
+        isCacheValid = false;
+    }
+    // The texture holds the subtree at its on-screen scale and rotation, so only a translation reuses it.
+    const float *matrix = getCombinedTransform().getMatrix();
+    const float *cachedMatrix = cachedTransform.getMatrix();
+    if (matrix[0] != cachedMatrix[0] || matrix[1] != cachedMatrix[1] || matrix[4] != cachedMatrix[4]
+        || matrix[5] != cachedMatrix[5]) {
+        isCacheValid = false;
+    }
+    if (!isCacheValid && (!sprite.getTexture() || FrameBudget::getCurrent().checkDue(*this))) {
+        redraw();
+    }
+}
+
+void CachedNode::redraw()
+{
+    std::lock_guard<std::recursive_mutex> lock(ResourceManager::getTextureMutex());
+    isCacheValid = true;
+    cachedTransform = getCombinedTransform();
+    const sf::FloatRect rect = cachedTransform.transformRect(getChildrenBounds());
+    const float left = std::floor(rect.left);
+    const float top = std::floor(rect.top);
+    const auto width = static_cast<unsigned int>(std::ceil(rect.left + rect.width - left));
+    const auto height = static_cast<unsigned int>(std::ceil(rect.top + rect.height - top));
+    if (width == 0 || height == 0) {
+        sprite = sf::Sprite();
+        return;
+    }
+    if (renderTexture.getSize() != sf::Vector2u(width, height) && !renderTexture.create(width, height)) {
+        sprite = sf::Sprite();
+        return;
+    }
+
+    renderTexture.setView(sf::View(sf::FloatRect(left, top, width, height)));
+    renderTexture.clear(sf::Color::Transparent);
+    Node::drawToTarget(renderTexture);
+    renderTexture.display();
+    sprite.setTexture(renderTexture.getTexture(), true);
+    sprite.setPosition(left, top);
+}
+
+sf::Transform CachedNode::getSpriteTransform()
+{
+    const float *matrix = getCombinedTransform().getMatrix();
+    const float *cachedMatrix = cachedTransform.getMatrix();
+    return sf::Transform().translate(matrix[12] - cachedMatrix[12], matrix[13] - cachedMatrix[13]);
+}
+
+}
@@ -0,0 +1,83 @@
+#include <CE/Core/Camera.hpp>
+#include <CE/constant.hpp>
+#include <cmath>
+
+namespace ce {
+
+Camera::Camera(const std::shared_ptr<TransformableNode> &content, const sf::FloatRect &viewport)
+    : content(content), viewport(viewport), center(content->getHalfX(), content->getHalfY()) {}
+
+const std::shared_ptr<TransformableNode> &Camera::getContent() const
+{
+    return content;
+}
+
+const sf::FloatRect &Camera::getViewport() const
+{
+    return viewport;
+}
+
+void Camera::setViewport(const sf::FloatRect &value)
+{
+    viewport = value;
+}
+
+const sf::Vector2f &Camera::getCenter() const
+{
+    return center;
+}
+
+void Camera::setCenter(float x, float y)
+{
+    center = sf::Vector2f(x, y);
+}
+
+float Camera::getZoom() const
+{
+    return zoom;
+}
+
+void Camera::setZoom(float value)
+{
+    zoom = value;
+}
+
+float Camera::getRotation() const
+{
+    return rotation;
+}
+
+void Camera::setRotation(float value)
+{
+    rotation = value;
+}
+
+sf::View Camera::getView(const sf::Vector2u &targetSize) const
+{
+    // Like CachedNode::redraw, the view follows the content's combined transform, so the camera
+    // keeps looking at the same local area when the content or its parents are moved.
+    const sf::Transform &transform = content->getCombinedTransform();
+    const float *matrix = transform.getMatrix();
+    const float scale = std::sqrt(matrix[0] * matrix[0] + matrix[1] * matrix[1]);
+    sf::View view(transform.transformPoint(center),
+                  sf::Vector2f(targetSize.x * viewport.width, targetSize.y * viewport.height) * (zoom * scale));
+    view.setRotation((rotation + std::atan2(matrix[1], matrix[0])) * 180 / MATH_PI);
+    view.setViewport(viewport);
+    return view;
+}
+
+bool Camera::checkPixelInViewport(const sf::Vector2i &pixel, const sf::Vector2u &targetSize) const
+{
+    return sf::FloatRect(viewport.left * targetSize.x, viewport.top * targetSize.y, viewport.width * targetSize.x,
+                         viewport.height * targetSize.y).contains(pixel.x, pixel.y);
+}
+
+sf::Vector2i Camera::mapPixel(const sf::Vector2i &pixel, const sf::Vector2u &targetSize) const
+{
+    const float x = (pixel.x - viewport.left * targetSize.x) / (viewport.width * targetSize.x);
+    const float y = (pixel.y - viewport.top * targetSize.y) / (viewport.height * targetSize.y);
+    const sf::Vector2f point = getView(targetSize).getInverseTransform().transformPoint(x * 2 - 1, 1 - y * 2);
+    return sf::Vector2i(static_cast<int>(std::floor(point.x)), static_cast<int>(std::floor(point.y)));
+}
+
+}
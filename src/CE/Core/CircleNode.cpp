@@ -4,7 +4,7 @@
 namespace ce {
 
 CircleNode::CircleNode(float radius, const sf::Color &color, bool isSelectable)
-    : VisualNode(isSelectable), shape(sf::CircleShape(radius))
+    : NodeKindTag(Kind::CIRCLE), BasicNode(isSelectable), shape(sf::CircleShape(radius))
 {
     shape.setOrigin(radius, radius);
     shape.setFillColor(color);
@@ -12,8 +12,11 @@ CircleNode::CircleNode(float radius, const sf::Color &color, bool isSelectable)
 
 void CircleNode::setAlpha(float value)
 {
-    shape.setFillColor(sf::Color(shape.getFillColor().r, shape.getFillColor().g,
-                                 shape.getFillColor().b, (sf::Uint8) (value * 255)));
+    const auto alpha = (sf::Uint8) (value * 255);
+    if (shape.getFillColor().a != alpha) {
+        shape.setFillColor(sf::Color(shape.getFillColor().r, shape.getFillColor().g, shape.getFillColor().b, alpha));
+        makeChanged();
+    }
 }
 
 float CircleNode::getWidth()
@@ -29,12 +32,8 @@ float CircleNode::getHeight()
 void CircleNode::setRadius(float value)
 {
     shape.setRadius(value);
-}
-
-void CircleNode::setScale(float value)
-{
-    shape.setScale(value, value);
-    makeTransformed();
+    makeChanged();
+    makeRectChanged();
 }
 
 sf::FloatRect CircleNode::getRect()
@@ -48,30 +47,12 @@ void CircleNode::setRotation(float value)
     makeTransformed();
 }
 
-void CircleNode::setOrigin(float x, float y)
-{
-    shape.setOrigin(x, y);
-    makeTransformed();
-}
-
-void CircleNode::setPos(float x, float y)
-{
-    shape.setPosition(x, y);
-    makeTransformed();
-}
-
 void CircleNode::rotate(float angle)
 {
     shape.rotate(angle);
     makeTransformed();
 }
 
-void CircleNode::move(float offsetX, float offsetY)
-{
-    shape.move(offsetX, offsetY);
-    makeTransformed();
-}
-
 bool CircleNode::checkPointOnIt(const sf::Vector2i &point)
 {
     sf::Vector2f mouseLocalPosition = translatePointToLocalCoordinates(point);
@@ -81,9 +62,9 @@ bool CircleNode::checkPointOnIt(const sf::Vector2i &point)
            <= shape.getRadius();
 }
 
-const sf::Transformable &CircleNode::getTransformable() const
+std::unique_ptr<sf::Drawable> CircleNode::copyDrawable() const
 {
-    return shape;
+    return std::unique_ptr<sf::Drawable>(new sf::CircleShape(shape));
 }
 
 const sf::Drawable &CircleNode::getDrawable() const
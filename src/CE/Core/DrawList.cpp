@@ -0,0 +1,82 @@
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/Profiler.hpp>
+
+namespace ce {
+
+void DrawList::reset(const sf::View &view, const sf::Color &clearColor)
+{
+    views.assign(1, view);
+    this->clearColor = clearColor;
+    vertices.clear();
+    entries.clear();
+}
+
+const sf::View &DrawList::getView() const
+{
+    return views.back();
+}
+
+void DrawList::setView(const sf::View &value)
+{
+    views.push_back(value);
+    entries.push_back({ nullptr, sf::Transform::Identity, views.size() - 1, 0, false, nullptr, true });
+}
+
+unsigned long DrawList::getEntryCount() const
+{
+    return entries.size();
+}
+
+sf::Vertex *DrawList::addVertices(const sf::Texture *texture, unsigned long count)
+{
+    const unsigned long firstVertex = vertices.size();
+    vertices.resize(firstVertex + count);
+    if (!entries.empty() && entries.back().isMergeable && entries.back().texture == texture) {
+        entries.back().vertexCount += count;
+    } else {
+        entries.push_back({ texture, sf::Transform::Identity, firstVertex, count, true, nullptr, false });
+    }
+    return vertices.data() + firstVertex;
+}
+
+void DrawList::addVertices(const sf::VertexArray &array, const sf::Texture *texture, const sf::Transform &transform)
+{
+    if (array.getVertexCount() == 0) {
+        return;
+    }
+    const unsigned long firstVertex = vertices.size();
+    vertices.insert(vertices.end(), &array[0], &array[0] + array.getVertexCount());
+    entries.push_back({ texture, transform, firstVertex, array.getVertexCount(), false, nullptr, false });
+}
+
+void DrawList::addDrawable(std::unique_ptr<sf::Drawable> drawable, const sf::Transform &transform)
+{
+    entries.push_back({ nullptr, transform, 0, 0, false, std::move(drawable), false });
+}
+
+void DrawList::drawToTarget(sf::RenderTarget &target) const
+{
+    const sf::View &view = views.front();
+    const sf::View &targetView = target.getView();
+    if (targetView.getCenter() != view.getCenter() || targetView.getSize() != view.getSize()
+        || targetView.getRotation() != view.getRotation()) {
+        target.setView(view);
+    }
+    target.clear(clearColor);
+    for (auto &entry : entries) {
+        if (entry.isViewChange) {
+            target.setView(views[entry.firstVertex]);
+            continue;
+        }
+        if (entry.drawable) {
+            target.draw(*entry.drawable, entry.transform);
+        } else {
+            sf::RenderStates states(entry.transform);
+            states.texture = entry.texture;
+            target.draw(vertices.data() + entry.firstVertex, entry.vertexCount, sf::Triangles, states);
+        }
+        Profiler::countDrawCall();
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+#include <CE/Core/FrameBudget.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace ce {
+
+constexpr float FrameBudget::SMOOTHING;
+constexpr float FrameBudget::HEADROOM;
+constexpr float FrameBudget::STEP_DOWN;
+constexpr float FrameBudget::STEP_UP;
+constexpr unsigned int FrameBudget::MAX_STRIDE;
+
+FrameBudget *FrameBudget::current = nullptr;
+
+FrameBudget &FrameBudget::getCurrent()
+{
+    // Nodes touched before any stage starts a frame see a budget that always allows full quality.
+    static FrameBudget idleBudget;
+    return current ? *current : idleBudget;
+}
+
+FrameBudget::~FrameBudget()
+{
+    if (current == this) {
+        current = nullptr;
+    }
+}
+
+const sf::Time &FrameBudget::getBudget() const
+{
+    return budget;
+}
+
+void FrameBudget::setBudget(const sf::Time &value)
+{
+    budget = value;
+    averageTime = 0;
+}
+
+float FrameBudget::getMinQuality() const
+{
+    return minQuality;
+}
+
+void FrameBudget::setMinQuality(float value)
+{
+    minQuality = std::min(std::max(value, 0.01f), 1.0f);
+    quality = std::max(quality, minQuality);
+}
+
+unsigned long FrameBudget::getFrame() const
+{
+    return frame;
+}
+
+float FrameBudget::getQuality() const
+{
+    return quality;
+}
+
+float FrameBudget::getQuality(const Node &node) const
+{
+    if (node.getPriority() == Node::Priority::HIGH) {
+        return 1;
+    } else if (node.getPriority() == Node::Priority::LOW) {
+        return quality * quality;
+    }
+    return quality;
+}
+
+bool FrameBudget::checkDue(const Node &node) const
+{
+    const float nodeQuality = getQuality(node);
+    if (nodeQuality >= 1) {
+        return true;
+    }
+    const auto stride = std::min(MAX_STRIDE, static_cast<unsigned int>(std::lround(1 / nodeQuality)));
+    // A Fibonacci hash of the address spreads nodes across frames; raw addresses share their low residues
+    // because of allocator alignment and pool strides.
+    const auto hash = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&node) * 0x9e3779b97f4a7c15ULL >> 32);
+    return (frame + hash) % stride == 0;
+}
+
+bool FrameBudget::startFrame(const sf::Time &workTime)
+{
+    current = this;
+    frame++;
+    const float previousQuality = quality;
+    if (budget == sf::Time::Zero) {
+        quality = 1;
+        return quality != previousQuality;
+    }
+
+    // Spikes lower the quality at once, while raising it waits for the average to show headroom.
+    averageTime += (workTime.asSeconds() - averageTime) * SMOOTHING;
+    if (workTime > budget) {
+        quality = std::max(quality - STEP_DOWN, minQuality);
+    } else if (averageTime < budget.asSeconds() * HEADROOM) {
+        quality = std::min(quality + STEP_UP, 1.0f);
+    }
+    return quality != previousQuality;
+}
+
+}
@@ -0,0 +1,43 @@
+#include <CE/Core/HeadlessStage.hpp>
+
+namespace ce {
+
+HeadlessStage::HeadlessStage(const sf::Vector2u &size) : size(size) {}
+
+sf::Vector2u HeadlessStage::getSize() const
+{
+    return size;
+}
+
+void HeadlessStage::setTimeStep(const sf::Time &value)
+{
+    timeStep = value;
+}
+
+void HeadlessStage::resize(const sf::Vector2u &value)
+{
+    auto event = sf::Event();
+    event.type = sf::Event::Resized;
+    event.size.width = value.x;
+    event.size.height = value.y;
+    pushEvent(event);
+}
+
+void HeadlessStage::advance(unsigned long frameCount)
+{
+    for (unsigned long i = 0; i < frameCount; i++) {
+        update();
+    }
+}
+
+void HeadlessStage::onResized(const sf::Vector2u &value)
+{
+    size = value;
+}
+
+sf::Time HeadlessStage::getElapsedTime()
+{
+    return getUpdateInterval() == sf::Time::Zero ? timeStep : getUpdateInterval();
+}
+
+}
@@ -0,0 +1,65 @@
+#include <CE/Core/Input.hpp>
+
+namespace ce {
+
+bool Input::checkKeyPressed(sf::Keyboard::Key key) const
+{
+    return key >= 0 && key < sf::Keyboard::KeyCount && pressedKeys[key];
+}
+
+const sf::Vector2i &Input::getMousePosition() const
+{
+    return mousePosition;
+}
+
+const std::vector<sf::Vector2i> &Input::getMouseMoves() const
+{
+    return mouseMoves;
+}
+
+void Input::enableMouseHistory()
+{
+    isMouseHistoryEnabled = true;
+}
+
+void Input::disableMouseHistory()
+{
+    isMouseHistoryEnabled = false;
+    mouseMoves.clear();
+}
+
+void Input::startFrame()
+{
+    mouseMoves.clear();
+}
+
+bool Input::pressKey(sf::Keyboard::Key key)
+{
+    if (key < 0 || key >= sf::Keyboard::KeyCount || pressedKeys[key]) {
+        return false;
+    }
+    pressedKeys[key] = true;
+    return true;
+}
+
+void Input::releaseKey(sf::Keyboard::Key key)
+{
+    if (key >= 0 && key < sf::Keyboard::KeyCount) {
+        pressedKeys[key] = false;
+    }
+}
+
+void Input::releaseKeys()
+{
+    pressedKeys.reset();
+}
+
+void Input::moveMouse(const sf::Vector2i &position)
+{
+    mousePosition = position;
+    if (isMouseHistoryEnabled) {
+        mouseMoves.push_back(position);
+    }
+}
+
+}
@@ -1,38 +1,23 @@
 #include <CE/Core/MimicNode.hpp>
-#include <CE/constant.hpp>
 
 namespace ce {
 
-MimicNode::MimicNode(bool isSelectable) : TransformableNode(isSelectable) {}
+MimicNode::MimicNode(bool isSelectable) : NodeKindTag(Kind::MIMIC), BasicNode(isSelectable) {}
 
 float MimicNode::getWidth()
 {
-    float width = 0;
-    for (auto &child : children) {
-        float nextWidth = child->getX() - child->getOriginX() + child->getWidth() * child->getScale();
-        if (nextWidth > width) {
-            width = nextWidth;
-        }
+    if (isResized) {
+        updateSize();
     }
-    return width;
+    return size.x;
 }
 
 float MimicNode::getHeight()
 {
-    float height = 0;
-    for (auto &child : children) {
-        float nextHeight = child->getY() - child->getOriginY() + child->getHeight() * child->getScale();
-        if (nextHeight > height) {
-            height = nextHeight;
-        }
+    if (isResized) {
+        updateSize();
     }
-    return height;
-}
-
-void MimicNode::setScale(float value)
-{
-    transformable.setScale(value, value);
-    makeTransformed();
+    return size.y;
 }
 
 sf::FloatRect MimicNode::getRect()
@@ -40,39 +25,43 @@ sf::FloatRect MimicNode::getRect()
     return transformable.getTransform().transformRect(sf::FloatRect(0, 0, getWidth(), getHeight()));
 }
 
-void MimicNode::setRotation(float value)
-{
-    transformable.setRotation(value * 180 / MATH_PI);
-    makeTransformed();
-}
-
-void MimicNode::setOrigin(float x, float y)
+void MimicNode::onDescendantsChanged()
 {
-    transformable.setOrigin(x, y);
-    makeTransformed();
+    makeResized();
+    TransformableNode::onDescendantsChanged();
 }
 
-void MimicNode::setPos(float x, float y)
+void MimicNode::onChildRectChanged(TransformableNode &child)
 {
-    transformable.setPosition(x, y);
-    makeTransformed();
+    makeResized();
+    TransformableNode::onChildRectChanged(child);
 }
 
-void MimicNode::rotate(float angle)
+void MimicNode::makeResized()
 {
-    transformable.rotate(angle * 180 / MATH_PI);
-    makeTransformed();
-}
-
-void MimicNode::move(float offsetX, float offsetY)
-{
-    transformable.move(offsetX, offsetY);
-    makeTransformed();
+    if (!isResized) {
+        isResized = true;
+        makeRectChanged();
+    }
 }
 
-const sf::Transformable &MimicNode::getTransformable() const
+void MimicNode::updateSize()
 {
-    return transformable;
+    isResized = false;
+    size = sf::Vector2f();
+    for (auto &child : children) {
+        if (!child) {
+            continue;
+        }
+        const float nextWidth = child->getX() - child->getOriginX() + child->getWidth() * child->getScale();
+        if (nextWidth > size.x) {
+            size.x = nextWidth;
+        }
+        const float nextHeight = child->getY() - child->getOriginY() + child->getHeight() * child->getScale();
+        if (nextHeight > size.y) {
+            size.y = nextHeight;
+        }
+    }
 }
 
 }
@@ -1,10 +1,53 @@
 #include <CE/Core/Node.hpp>
-#include <CE/Core/TransformableNode.hpp>
+#include <CE/Core/CircleNode.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/MimicNode.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Core/RectangleNode.hpp>
+#include <CE/Core/SpriteNode.hpp>
+#include <CE/UI/Text.hpp>
+#include <CE/Utility/JobPool.hpp>
+#include <algorithm>
 
 namespace ce {
 
+namespace {
+
+sf::FloatRect uniteRects(const sf::FloatRect &first, const sf::FloatRect &second)
+{
+    if (second.width <= 0 && second.height <= 0) {
+        return first;
+    } else if (first.width <= 0 && first.height <= 0) {
+        return second;
+    }
+    const float left = std::min(first.left, second.left);
+    const float top = std::min(first.top, second.top);
+    return { left, top, std::max(first.left + first.width, second.left + second.width) - left,
+             std::max(first.top + first.height, second.top + second.height) - top };
+}
+
+}
+
+std::atomic<unsigned long> Node::hitTestGeneration(1);
+std::atomic<unsigned int> Node::parallelUpdateCount(0);
+
+unsigned long Node::getHitTestGeneration()
+{
+    return hitTestGeneration;
+}
+
 Node::Node(bool isSelectable) : isSelectable(isSelectable) {}
 
+Node::~Node()
+{
+    for (auto &child : children) {
+        if (child) {
+            child->parent = nullptr;
+        }
+    }
+}
+
 bool Node::checkSelectable() const
 {
     return isSelectable;
@@ -14,25 +57,95 @@ void Node::setSelectable(bool value)
 {
     if (isSelectable != value) {
         isSelectable = value;
+        hitTestGeneration++;
         onMouseLeft();
     }
 }
 
-std::shared_ptr<Node> Node::getParent() const
+bool Node::checkVisible() const
+{
+    return isVisible;
+}
+
+void Node::setVisible(bool value)
+{
+    if (isVisible != value) {
+        isVisible = value;
+        hitTestGeneration++;
+        if (parent) {
+            parent->onDescendantsChanged();
+        }
+    }
+}
+
+Node::Priority Node::getPriority() const
+{
+    return priority;
+}
+
+void Node::setPriority(Priority value)
+{
+    priority = value;
+}
+
+bool Node::checkOnScreen() const
+{
+    // Descendants of a cache are drawn into its texture, so they are on screen whenever the cache is.
+    const Node *drawnNode = this;
+    for (const Node *ancestor = parent; ancestor; ancestor = ancestor->parent) {
+        if (ancestor->isCaching) {
+            drawnNode = ancestor;
+        }
+    }
+    return drawnNode->drawnFrame + 1 >= FrameBudget::getCurrent().getFrame();
+}
+
+Node *Node::getParent() const
 {
-    return parent.lock();
+    return parent;
 }
 
-const sf::Window &Node::getWindow() const
+BaseStage &Node::getStage() const
 {
-    return parent.lock()->getWindow();
+    return parent->getStage();
+}
+
+float Node::getInterpolation() const
+{
+    return parent->getInterpolation();
+}
+
+int Node::getZIndex() const
+{
+    return zIndex;
+}
+
+void Node::setZIndex(int value)
+{
+    if (zIndex != value) {
+        zIndex = value;
+        hitTestGeneration++;
+        if (parent) {
+            parent->isOrderChanged = true;
+        }
+    }
 }
 
 void Node::update()
 {
-    for (auto &child : children) {
-        child->update();
+    Profiler::countUpdatedNode();
+    prepareChildren();
+    iterationDepth++;
+    if (isParallelUpdateEnabled && children.size() > 1) {
+        updateChildrenInParallel();
+    } else {
+        for (unsigned long i = 0; i < children.size(); i++) {
+            if (children[i]) {
+                updateChild(*children[i]);
+            }
+        }
     }
+    iterationDepth--;
     onUpdated();
 }
 
@@ -41,60 +154,476 @@ void Node::addChild(const std::shared_ptr<TransformableNode> &child)
     if (child->getParent()) {
         child->removeFromParent();
     }
-    child->setParent(sharedFromThis());
+    child->setParent(this);
+    child->childIndex = children.size();
     children.push_back(child);
+    if (child->zIndex < topZIndex) {
+        isOrderChanged = true;
+    } else {
+        topZIndex = child->zIndex;
+    }
+    if (isSpatialIndexBuilt) {
+        spatialIndex->insert(child.get(), children.size() - 1, child->getRect());
+    }
+    hitTestGeneration++;
     child->onAdded();
+    onDescendantsChanged();
 }
 
 void Node::removeChild(const std::shared_ptr<TransformableNode> &child)
 {
-    auto it = std::find(children.begin(), children.end(), child);
-    if (it != children.end()) {
-        child->setParent(nullptr);
-        children.erase(it);
+    if (child->parent != this) {
+        return;
     }
+    child->setParent(nullptr);
+    children[child->childIndex] = nullptr;
+    tombstoneCount++;
+    isSpatialIndexBuilt = false;
+    hitTestGeneration++;
+    onDescendantsChanged();
 }
 
 void Node::removeChildren(unsigned long firstIndex, long lastIndex)
 {
+    prepareChildren();
     const auto begin = children.begin() + firstIndex;
     const auto end = lastIndex == -1 || lastIndex > children.size()
             ? children.end()
             : children.begin() + lastIndex;
-    std::for_each(begin, end, [this](const std::shared_ptr<Node> &child) {
-        child->setParent(nullptr);
-    });
-    children.erase(begin, end);
+    if (iterationDepth > 0) {
+        // A traversal is walking these entries, so they become tombstones like in removeChild.
+        std::for_each(begin, end, [this](std::shared_ptr<TransformableNode> &child) {
+            if (child) {
+                child->setParent(nullptr);
+                child = nullptr;
+                tombstoneCount++;
+            }
+        });
+    } else {
+        std::for_each(begin, end, [](const std::shared_ptr<TransformableNode> &child) {
+            if (child) {
+                child->setParent(nullptr);
+            }
+        });
+        children.erase(begin, end);
+        tombstoneCount = std::count(children.begin(), children.end(), nullptr);
+        updateChildIndices(firstIndex);
+    }
+    isSpatialIndexBuilt = false;
+    hitTestGeneration++;
+    onDescendantsChanged();
+}
+
+void Node::enableSpatialIndex(float cellSize)
+{
+    spatialIndex.reset(new SpatialGrid(cellSize));
+    isSpatialIndexBuilt = false;
+}
+
+void Node::disableSpatialIndex()
+{
+    spatialIndex.reset();
+    isSpatialIndexBuilt = false;
+}
+
+void Node::enableParallelUpdate()
+{
+    isParallelUpdateEnabled = true;
+}
+
+void Node::disableParallelUpdate()
+{
+    isParallelUpdateEnabled = false;
 }
 
-std::shared_ptr<Node> Node::select(const sf::Vector2i &mousePosition)
+Node *Node::select(const sf::Vector2i &mousePosition)
 {
-    std::shared_ptr<Node> selectedChild;
-    auto it = std::find_if(children.rbegin(), children.rend(), [mousePosition](const std::shared_ptr<Node> &child)
-        -> bool { return child->checkPointOnIt(mousePosition); });
-    if (it != children.rend()) {
-        selectedChild = (*it)->select(mousePosition);
+    Node *selectedChild = nullptr;
+    TransformableNode *child = selectChild(mousePosition);
+    if (child) {
+        selectedChild = child->select(mousePosition);
     }
     if (selectedChild && selectedChild->checkSelectable()) {
         return selectedChild;
     }
     if (checkSelectable()) {
-        return sharedFromThis();
+        return this;
     }
     return nullptr;
 }
 
+TransformableNode *Node::selectChild(const sf::Vector2i &point)
+{
+    prepareChildren();
+    if (!spatialIndex) {
+        auto it = std::find_if(children.rbegin(), children.rend(),
+            [point](const std::shared_ptr<TransformableNode> &child) -> bool {
+                return child && child->isVisible && checkPointOnChild(*child, point);
+            });
+        return it != children.rend() ? it->get() : nullptr;
+    }
+
+    if (!isSpatialIndexBuilt) {
+        buildSpatialIndex();
+    }
+    const sf::Vector2f localPoint = getCombinedTransform().getInverse().transformPoint(point.x, point.y);
+    const std::vector<unsigned long> &candidates = spatialIndex->getCandidates(localPoint);
+    for (auto it = candidates.rbegin(); it != candidates.rend(); it++) {
+        if (children[*it]->isVisible && checkPointOnChild(*children[*it], point)) {
+            return children[*it].get();
+        }
+    }
+    return nullptr;
+}
+
+bool Node::checkHitCacheable(Node &node) const
+{
+    for (const Node *current = &node; current != this; current = current->parent) {
+        if (!current->parent) {
+            return false;
+        }
+    }
+    return !node.checkSelectableDescendants();
+}
+
+unsigned long Node::getHitPathStamp(Node &node) const
+{
+    // Moves and resizes reach the parent through onChildRectChanged, so a change of the node, of an ancestor
+    // or of a sibling of either changes the stamp.
+    unsigned long stamp = 0;
+    for (const Node *ancestor = node.parent; ancestor; ancestor = ancestor->parent) {
+        stamp += ancestor->childRectVersion;
+        if (ancestor == this) {
+            break;
+        }
+    }
+    return stamp;
+}
+
+bool Node::checkStillHit(Node &node, const sf::Vector2i &point)
+{
+    for (Node *current = &node; current != this; current = current->parent) {
+        if (!current->parent || !current->checkPointOnIt(point)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Node::checkInParallelUpdate()
+{
+    return parallelUpdateCount > 0;
+}
+
+Node *Node::selectInChild(TransformableNode &child, const sf::Vector2i &point)
+{
+    return checkPointOnChild(child, point) ? child.select(point) : nullptr;
+}
+
 void Node::drawToTarget(sf::RenderTarget &target)
+{
+    Profiler::countVisitedNode();
+    prepareChildren();
+    if (children.empty()) {
+        return;
+    }
+
+    const sf::View &view = target.getView();
+    const sf::FloatRect viewRect = view.getInverseTransform().transformRect(sf::FloatRect(-1, -1, 2, 2));
+    const sf::Transform &combinedTransform = getCombinedTransform();
+    iterationDepth++;
+    for (unsigned long i = 0; i < children.size(); i++) {
+        if (children[i] && children[i]->isVisible && checkChildInView(*children[i], combinedTransform, viewRect)) {
+            drawChildToTarget(*children[i], target);
+        }
+    }
+    iterationDepth--;
+}
+
+void Node::drawToList(DrawList &list)
+{
+    Profiler::countVisitedNode();
+    prepareChildren();
+    if (children.empty()) {
+        return;
+    }
+
+    const sf::FloatRect viewRect = list.getView().getInverseTransform().transformRect(sf::FloatRect(-1, -1, 2, 2));
+    const sf::Transform &combinedTransform = getCombinedTransform();
+    iterationDepth++;
+    for (unsigned long i = 0; i < children.size(); i++) {
+        if (children[i] && children[i]->isVisible && checkChildInView(*children[i], combinedTransform, viewRect)) {
+            drawChildToList(*children[i], list);
+        }
+    }
+    iterationDepth--;
+}
+
+void Node::onDescendantsChanged()
+{
+    isChildrenRectValid.store(false, std::memory_order_relaxed);
+    if (!getParent()) {
+        return;
+    }
+    if (getParent()->isUpdatingInParallel) {
+        getParent()->isDescendantsChangePending = true;
+    } else {
+        getParent()->onDescendantsChanged();
+    }
+}
+
+void Node::collectBatched(BatchNode &batch)
+{
+    for (unsigned long i = 0; i < children.size(); i++) {
+        if (children[i] && children[i]->isVisible) {
+            children[i]->collectBatched(batch);
+        }
+    }
+}
+
+unsigned long Node::getDescendantsTransformVersion() const
+{
+    return descendantsTransformVersion.load(std::memory_order_relaxed);
+}
+
+unsigned long Node::getDescendantsChangeVersion() const
+{
+    return descendantsChangeVersion.load(std::memory_order_relaxed);
+}
+
+sf::FloatRect Node::getChildrenBounds()
+{
+    if (!isChildrenRectValid.load(std::memory_order_relaxed)) {
+        childrenRect = sf::FloatRect();
+        for (auto &child : children) {
+            if (child && child->isVisible) {
+                childrenRect = uniteRects(childrenRect, getChildBounds(*child));
+            }
+        }
+        isChildrenRectValid.store(true, std::memory_order_relaxed);
+    }
+    return childrenRect;
+}
+
+void Node::onChildRectChanged(TransformableNode &child)
+{
+    childRectVersion++;
+    if (isSpatialIndexBuilt) {
+        spatialIndex->update(&child, child.getRect());
+    }
+}
+
+bool Node::checkSelectableDescendants() const
 {
     for (auto &child : children) {
-        child->drawToTarget(target);
+        if (child && (child->isSelectable || child->checkSelectableDescendants())) {
+            return true;
+        }
     }
+    return false;
 }
 
-void Node::setParent(const std::shared_ptr<Node> &value)
+void Node::setParent(Node *value)
 {
     parent = value;
     makeTransformed();
 }
 
+void Node::buildSpatialIndex()
+{
+    spatialIndex->clear();
+    for (unsigned long i = 0; i < children.size(); i++) {
+        if (children[i]) {
+            spatialIndex->insert(children[i].get(), i, children[i]->getRect());
+        }
+    }
+    isSpatialIndexBuilt = true;
+}
+
+void Node::updateChildrenInParallel()
+{
+    isUpdatingInParallel = true;
+    parallelUpdateCount++;
+    JobPool::getShared().run(children.size(), [this](unsigned long index) {
+        if (children[index]) {
+            updateChild(*children[index]);
+        }
+    });
+    parallelUpdateCount--;
+    isUpdatingInParallel = false;
+
+    for (auto &child : children) {
+        if (child && child->isRectChangePending) {
+            child->isRectChangePending = false;
+            onChildRectChanged(*child);
+        }
+    }
+    if (isDescendantsChangePending) {
+        isDescendantsChangePending = false;
+        onDescendantsChanged();
+    }
+}
+
+void Node::prepareChildren()
+{
+    if (iterationDepth > 0) {
+        return;
+    }
+    if (tombstoneCount > 0) {
+        children.erase(std::remove(children.begin(), children.end(), nullptr), children.end());
+        tombstoneCount = 0;
+        updateChildIndices(0);
+        isSpatialIndexBuilt = false;
+    }
+    if (isOrderChanged) {
+        isOrderChanged = false;
+        std::stable_sort(children.begin(), children.end(),
+            [](const std::shared_ptr<TransformableNode> &left, const std::shared_ptr<TransformableNode> &right) -> bool {
+                return left->zIndex < right->zIndex;
+            });
+        topZIndex = children.empty() ? std::numeric_limits<int>::min() : children.back()->zIndex;
+        updateChildIndices(0);
+        isSpatialIndexBuilt = false;
+        onDescendantsChanged();
+    }
+}
+
+void Node::updateChildIndices(unsigned long firstIndex)
+{
+    for (unsigned long i = firstIndex; i < children.size(); i++) {
+        if (children[i]) {
+            children[i]->childIndex = i;
+        }
+    }
+}
+
+void Node::updateChild(TransformableNode &child)
+{
+    switch (child.getKind()) {
+    case TransformableNode::Kind::MIMIC:
+        static_cast<MimicNode &>(child).MimicNode::update();
+        break;
+    case TransformableNode::Kind::RECTANGLE:
+        static_cast<RectangleNode &>(child).RectangleNode::update();
+        break;
+    case TransformableNode::Kind::CIRCLE:
+        static_cast<CircleNode &>(child).CircleNode::update();
+        break;
+    case TransformableNode::Kind::SPRITE:
+        static_cast<SpriteNode &>(child).SpriteNode::update();
+        break;
+    case TransformableNode::Kind::TEXT:
+        static_cast<Text &>(child).Text::update();
+        break;
+    default:
+        child.update();
+    }
+}
+
+sf::FloatRect Node::getChildRect(TransformableNode &child)
+{
+    switch (child.getKind()) {
+    case TransformableNode::Kind::MIMIC:
+        return static_cast<MimicNode &>(child).MimicNode::getRect();
+    case TransformableNode::Kind::RECTANGLE:
+        return static_cast<RectangleNode &>(child).RectangleNode::getRect();
+    case TransformableNode::Kind::CIRCLE:
+        return static_cast<CircleNode &>(child).CircleNode::getRect();
+    case TransformableNode::Kind::SPRITE:
+        return static_cast<SpriteNode &>(child).SpriteNode::getRect();
+    case TransformableNode::Kind::TEXT:
+        return static_cast<Text &>(child).Text::getRect();
+    default:
+        return child.getRect();
+    }
+}
+
+sf::FloatRect Node::getChildBounds(TransformableNode &child)
+{
+    const sf::FloatRect rect = getChildRect(child);
+    if (child.children.empty()) {
+        return rect;
+    }
+    return uniteRects(rect, child.getTransformable().getTransform().transformRect(child.getChildrenBounds()));
+}
+
+bool Node::checkChildInView(TransformableNode &child, const sf::Transform &transform,
+                            const sf::FloatRect &viewRect)
+{
+    return transform.transformRect(getChildBounds(child)).intersects(viewRect);
+}
+
+void Node::makeChildrenRectChanged()
+{
+    for (Node *node = this; node; node = node->parent) {
+        node->isChildrenRectValid.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool Node::checkPointOnChild(TransformableNode &child, const sf::Vector2i &point)
+{
+    switch (child.getKind()) {
+    case TransformableNode::Kind::MIMIC:
+        return static_cast<MimicNode &>(child).MimicNode::checkPointOnIt(point);
+    case TransformableNode::Kind::RECTANGLE:
+        return static_cast<RectangleNode &>(child).RectangleNode::checkPointOnIt(point);
+    case TransformableNode::Kind::CIRCLE:
+        return static_cast<CircleNode &>(child).CircleNode::checkPointOnIt(point);
+    case TransformableNode::Kind::SPRITE:
+        return static_cast<SpriteNode &>(child).SpriteNode::checkPointOnIt(point);
+    case TransformableNode::Kind::TEXT:
+        return static_cast<Text &>(child).Text::checkPointOnIt(point);
+    default:
+        return child.checkPointOnIt(point);
+    }
+}
+
+void Node::drawChildToTarget(TransformableNode &child, sf::RenderTarget &target)
+{
+    child.drawnFrame = FrameBudget::getCurrent().getFrame();
+    switch (child.getKind()) {
+    case TransformableNode::Kind::MIMIC:
+        static_cast<MimicNode &>(child).MimicNode::drawToTarget(target);
+        break;
+    case TransformableNode::Kind::RECTANGLE:
+        static_cast<RectangleNode &>(child).RectangleNode::drawToTarget(target);
+        break;
+    case TransformableNode::Kind::CIRCLE:
+        static_cast<CircleNode &>(child).CircleNode::drawToTarget(target);
+        break;
+    case TransformableNode::Kind::SPRITE:
+        static_cast<SpriteNode &>(child).SpriteNode::drawToTarget(target);
+        break;
+    case TransformableNode::Kind::TEXT:
+        static_cast<Text &>(child).Text::drawToTarget(target);
+        break;
+    default:
+        child.drawToTarget(target);
+    }
+}
+
+void Node::drawChildToList(TransformableNode &child, DrawList &list)
+{
+    child.drawnFrame = FrameBudget::getCurrent().getFrame();
+    switch (child.getKind()) {
+    case TransformableNode::Kind::MIMIC:
+        static_cast<MimicNode &>(child).MimicNode::drawToList(list);
+        break;
+    case TransformableNode::Kind::RECTANGLE:
+        static_cast<RectangleNode &>(child).RectangleNode::drawToList(list);
+        break;
+    case TransformableNode::Kind::CIRCLE:
+        static_cast<CircleNode &>(child).CircleNode::drawToList(list);
+        break;
+    case TransformableNode::Kind::SPRITE:
+        static_cast<SpriteNode &>(child).SpriteNode::drawToList(list);
+        break;
+    case TransformableNode::Kind::TEXT:
+        static_cast<Text &>(child).Text::drawToList(list);
+        break;
+    default:
+        child.drawToList(list);
+    }
+}
+
 }
@@ -0,0 +1,228 @@
+#include <CE/Core/ParticleSystemNode.hpp>
+#include <CE/Core/BaseStage.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Utility/JobPool.hpp>
+#include <CE/constant.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ce {
+
+constexpr unsigned long ParticleSystemNode::PARALLEL_THRESHOLD;
+constexpr unsigned long ParticleSystemNode::CHUNK_SIZE;
+
+ParticleSystemNode::ParticleSystemNode(unsigned long capacity, float particleSize)
+    : capacity(capacity), particleSize(particleSize), vertices(sf::Triangles)
+{
+    positionsX.reserve(capacity);
+    positionsY.reserve(capacity);
+    velocitiesX.reserve(capacity);
+    velocitiesY.reserve(capacity);
+    lives.reserve(capacity);
+    maxLives.reserve(capacity);
+    colors.reserve(capacity);
+}
+
+unsigned long ParticleSystemNode::getParticleCount() const
+{
+    return lives.size();
+}
+
+void ParticleSystemNode::setGravity(const sf::Vector2f &value)
+{
+    gravity = value;
+}
+
+void ParticleSystemNode::setTimeStep(const sf::Time &value)
+{
+    timeStep = value.asSeconds();
+}
+
+void ParticleSystemNode::emit(const sf::Vector2f &position, const sf::Vector2f &velocity, float life,
+                              const sf::Color &color)
+{
+    if (lives.size() >= capacity * FrameBudget::getCurrent().getQuality(*this) || life <= 0) {
+        return;
+    }
+    positionsX.push_back(position.x);
+    positionsY.push_back(position.y);
+    velocitiesX.push_back(velocity.x);
+    velocitiesY.push_back(velocity.y);
+    lives.push_back(life);
+    maxLives.push_back(life);
+    colors.push_back(color);
+}
+
+void ParticleSystemNode::burst(unsigned long count, const sf::Vector2f &position, float speed, float life,
+                               const sf::Color &color)
+{
+    std::uniform_real_distribution<float> angleDistribution(0, 2 * MATH_PI);
+    std::uniform_real_distribution<float> speedDistribution(speed / 2, speed);
+    const auto scaledCount = static_cast<unsigned long>(std::ceil(count * FrameBudget::getCurrent().getQuality(*this)));
+    for (unsigned long i = 0; i < scaledCount; i++) {
+        const float angle = angleDistribution(random);
+        const float particleSpeed = speedDistribution(random);
+        emit(position, sf::Vector2f(std::cos(angle) * particleSpeed, std::sin(angle) * particleSpeed), life, color);
+    }
+}
+
+void ParticleSystemNode::clear()
+{
+    positionsX.clear();
+    positionsY.clear();
+    velocitiesX.clear();
+    velocitiesY.clear();
+    lives.clear();
+    maxLives.clear();
+    colors.clear();
+    vertices.clear();
+    bounds = sf::FloatRect();
+    makeRectChanged();
+}
+
+void ParticleSystemNode::setAlpha(float value)
+{
+    alpha = value;
+    makeChanged();
+}
+
+float ParticleSystemNode::getWidth()
+{
+    return bounds.left + bounds.width;
+}
+
+float ParticleSystemNode::getHeight()
+{
+    return bounds.top + bounds.height;
+}
+
+sf::FloatRect ParticleSystemNode::getRect()
+{
+    return transformable.getTransform().transformRect(bounds);
+}
+
+void ParticleSystemNode::drawToTarget(sf::RenderTarget &target)
+{
+    if (vertices.getVertexCount() > 0) {
+        target.draw(vertices, getCombinedTransform());
+        Profiler::countDrawCall();
+    }
+    Node::drawToTarget(target);
+}
+
+void ParticleSystemNode::drawToList(DrawList &list)
+{
+    list.addVertices(vertices, nullptr, getCombinedTransform());
+    Node::drawToList(list);
+}
+
+void ParticleSystemNode::update()
+{
+    if (!lives.empty()) {
+        currentStep = timeStep > 0 ? timeStep : getStage().getTickTime().asSeconds();
+        runChunked(&ParticleSystemNode::integrate);
+        removeDeadParticles();
+        vertices.resize(lives.size() * QUAD_VERTEX_COUNT);
+        runChunked(&ParticleSystemNode::writeVertices);
+        makeChanged();
+        makeRectChanged();
+    }
+    VisualNode::update();
+}
+
+const sf::Drawable &ParticleSystemNode::getDrawable() const
+{
+    return vertices;
+}
+
+void ParticleSystemNode::integrate(unsigned long first, unsigned long last)
+{
+    const float step = currentStep;
+    const float gravityX = gravity.x * step;
+    const float gravityY = gravity.y * step;
+    float *x = positionsX.data();
+    float *y = positionsY.data();
+    float *velocityX = velocitiesX.data();
+    float *velocityY = velocitiesY.data();
+    float *life = lives.data();
+    for (unsigned long i = first; i < last; i++) {
+        velocityX[i] += gravityX;
+        velocityY[i] += gravityY;
+        x[i] += velocityX[i] * step;
+        y[i] += velocityY[i] * step;
+        life[i] -= step;
+    }
+}
+
+void ParticleSystemNode::removeDeadParticles()
+{
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    for (unsigned long i = 0; i < lives.size();) {
+        if (lives[i] > 0) {
+            if (i == 0) {
+                minX = maxX = positionsX[0];
+                minY = maxY = positionsY[0];
+            } else {
+                minX = std::min(minX, positionsX[i]);
+                maxX = std::max(maxX, positionsX[i]);
+                minY = std::min(minY, positionsY[i]);
+                maxY = std::max(maxY, positionsY[i]);
+            }
+            i++;
+            continue;
+        }
+        positionsX[i] = positionsX.back();
+        positionsX.pop_back();
+        positionsY[i] = positionsY.back();
+        positionsY.pop_back();
+        velocitiesX[i] = velocitiesX.back();
+        velocitiesX.pop_back();
+        velocitiesY[i] = velocitiesY.back();
+        velocitiesY.pop_back();
+        lives[i] = lives.back();
+        lives.pop_back();
+        maxLives[i] = maxLives.back();
+        maxLives.pop_back();
+        colors[i] = colors.back();
+        colors.pop_back();
+    }
+    const float halfSize = particleSize / 2;
+    bounds = lives.empty() ? sf::FloatRect()
+                           : sf::FloatRect(minX - halfSize, minY - halfSize,
+                                           maxX - minX + particleSize, maxY - minY + particleSize);
+}
+
+void ParticleSystemNode::writeVertices(unsigned long first, unsigned long last)
+{
+    const float halfSize = particleSize / 2;
+    for (unsigned long i = first; i < last; i++) {
+        sf::Color color = colors[i];
+        color.a = static_cast<sf::Uint8>(color.a * alpha * (lives[i] / maxLives[i]));
+        sf::Vertex *quad = &vertices[i * QUAD_VERTEX_COUNT];
+        const float left = positionsX[i] - halfSize;
+        const float top = positionsY[i] - halfSize;
+        quad[0] = sf::Vertex(sf::Vector2f(left, top), color);
+        quad[1] = sf::Vertex(sf::Vector2f(left + particleSize, top), color);
+        quad[2] = sf::Vertex(sf::Vector2f(left, top + particleSize), color);
+        quad[3] = quad[2];
+        quad[4] = quad[1];
+        quad[5] = sf::Vertex(sf::Vector2f(left + particleSize, top + particleSize), color);
+    }
+}
+
+void ParticleSystemNode::runChunked(void (ParticleSystemNode::*pass)(unsigned long, unsigned long))
+{
+    const unsigned long count = lives.size();
+    if (count < PARALLEL_THRESHOLD) {
+        (this->*pass)(0, count);
+        return;
+    }
+    const unsigned long chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    JobPool::getShared().run(chunkCount, [this, pass, count](unsigned long chunk) {
+        (this->*pass)(chunk * CHUNK_SIZE, std::min(count, (chunk + 1) * CHUNK_SIZE));
+    });
+}
+
+}
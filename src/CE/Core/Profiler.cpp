@@ -0,0 +1,72 @@
+#include <CE/Core/Profiler.hpp>
+
+namespace ce {
+
+std::atomic<unsigned long> Profiler::drawCallCount(0);
+std::atomic<unsigned long> Profiler::updatedNodeCount(0);
+std::atomic<unsigned long> Profiler::visitedNodeCount(0);
+std::atomic<unsigned long> Profiler::transformCount(0);
+Profiler *Profiler::current = nullptr;
+
+sf::Time FrameStats::getFrameTime() const
+{
+    return eventTime + updateTime + drawTime + displayTime;
+}
+
+sf::Time FrameStats::getWorkTime() const
+{
+    return eventTime + updateTime + drawTime;
+}
+
+Profiler::~Profiler()
+{
+    if (current == this) {
+        current = nullptr;
+    }
+}
+
+const FrameStats &Profiler::getLastFrame()
+{
+    return getCurrent().lastFrame;
+}
+
+void Profiler::startFrame(Profiler &profiler)
+{
+    // The counts made since the last start belong to the profiler that was current then.
+    getCurrent().collectCounts();
+    current = &profiler;
+    profiler.lastFrame = profiler.currentFrame;
+    profiler.currentFrame = FrameStats();
+    profiler.phaseClock.restart();
+}
+
+void Profiler::finishPhase(Phase phase)
+{
+    FrameStats &currentFrame = getCurrent().currentFrame;
+    const sf::Time elapsed = getCurrent().phaseClock.restart();
+    if (phase == Phase::EVENTS) {
+        currentFrame.eventTime += elapsed;
+    } else if (phase == Phase::UPDATE) {
+        currentFrame.updateTime += elapsed;
+    } else if (phase == Phase::DRAW) {
+        currentFrame.drawTime += elapsed;
+    } else if (phase == Phase::DISPLAY) {
+        currentFrame.displayTime += elapsed;
+    }
+}
+
+Profiler &Profiler::getCurrent()
+{
+    static Profiler idleProfiler;
+    return current ? *current : idleProfiler;
+}
+
+void Profiler::collectCounts()
+{
+    currentFrame.drawCallCount += drawCallCount.exchange(0, std::memory_order_relaxed);
+    currentFrame.updatedNodeCount += updatedNodeCount.exchange(0, std::memory_order_relaxed);
+    currentFrame.visitedNodeCount += visitedNodeCount.exchange(0, std::memory_order_relaxed);
+    currentFrame.transformCount += transformCount.exchange(0, std::memory_order_relaxed);
+}
+
+}
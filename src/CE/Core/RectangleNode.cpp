@@ -1,18 +1,20 @@
 #include <CE/Core/RectangleNode.hpp>
-#include <CE/constant.hpp>
 
 namespace ce {
 
 RectangleNode::RectangleNode(float width, float height, const sf::Color &color, bool isSelectable)
-    : VisualNode(isSelectable), shape(sf::RectangleShape(sf::Vector2f(width, height)))
+    : NodeKindTag(Kind::RECTANGLE), BasicNode(isSelectable), shape(sf::RectangleShape(sf::Vector2f(width, height)))
 {
     shape.setFillColor(color);
 }
 
 void RectangleNode::setAlpha(float value)
 {
-    shape.setFillColor(sf::Color(shape.getFillColor().r, shape.getFillColor().g,
-                                 shape.getFillColor().b, (sf::Uint8) (value * 255)));
+    const auto alpha = (sf::Uint8) (value * 255);
+    if (shape.getFillColor().a != alpha) {
+        shape.setFillColor(sf::Color(shape.getFillColor().r, shape.getFillColor().g, shape.getFillColor().b, alpha));
+        makeChanged();
+    }
 }
 
 float RectangleNode::getWidth()
@@ -35,55 +37,40 @@ void RectangleNode::setHeight(float value)
     setSize(getWidth(), value);
 }
 
-void RectangleNode::setScale(float scale)
-{
-    shape.setScale(scale, scale);
-    makeTransformed();
-}
-
 sf::FloatRect RectangleNode::getRect()
 {
     return shape.getGlobalBounds();
 }
 
-void RectangleNode::setRotation(float value)
-{
-    shape.setRotation(value * 180 / MATH_PI);
-    makeTransformed();
-}
-
 void RectangleNode::setSize(float width, float height)
 {
+    if (shape.getSize() == sf::Vector2f(width, height)) {
+        return;
+    }
     shape.setSize(sf::Vector2f(width, height));
+    makeChanged();
+    makeRectChanged();
 }
 
-void RectangleNode::setOrigin(float x, float y)
+bool RectangleNode::checkBatchable() const
 {
-    shape.setOrigin(x, y);
-    makeTransformed();
+    return shape.getOutlineThickness() == 0;
 }
 
-void RectangleNode::setPos(float x, float y)
+const sf::Texture *RectangleNode::getTexture() const
 {
-    shape.setPosition(x, y);
-    makeTransformed();
+    return shape.getTexture();
 }
 
-void RectangleNode::rotate(float angle)
+void RectangleNode::writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const
 {
-    shape.rotate(angle * 180 / MATH_PI);
-    makeTransformed();
+    fillQuad(vertices, transform * shape.getTransform(), shape.getLocalBounds(), shape.getTextureRect(),
+             shape.getFillColor());
 }
 
-void RectangleNode::move(float offsetX, float offsetY)
+std::unique_ptr<sf::Drawable> RectangleNode::copyDrawable() const
 {
-    shape.move(offsetX, offsetY);
-    makeTransformed();
-}
-
-const sf::Transformable &RectangleNode::getTransformable() const
-{
-    return shape;
+    return std::unique_ptr<sf::Drawable>(new sf::RectangleShape(shape));
 }
 
 const sf::Drawable &RectangleNode::getDrawable() const
@@ -0,0 +1,85 @@
+#include <CE/Core/SpatialGrid.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ce {
+
+SpatialGrid::SpatialGrid(float cellSize) : cellSize(cellSize) {}
+
+const std::vector<unsigned long> &SpatialGrid::getCandidates(const sf::Vector2f &point) const
+{
+    static const std::vector<unsigned long> noCandidates;
+    auto it = cells.find(getKey((int) std::floor(point.x / cellSize), (int) std::floor(point.y / cellSize)));
+    return it != cells.end() ? it->second : noCandidates;
+}
+
+void SpatialGrid::insert(const TransformableNode *node, unsigned long index, const sf::FloatRect &rect)
+{
+    const sf::IntRect range = getCellRange(rect);
+    entries[node] = { index, range };
+    addToCells(index, range);
+}
+
+void SpatialGrid::update(const TransformableNode *node, const sf::FloatRect &rect)
+{
+    auto it = entries.find(node);
+    if (it == entries.end()) {
+        return;
+    }
+    const sf::IntRect range = getCellRange(rect);
+    if (range != it->second.cells) {
+        removeFromCells(it->second.index, it->second.cells);
+        addToCells(it->second.index, range);
+        it->second.cells = range;
+    }
+}
+
+void SpatialGrid::clear()
+{
+    entries.clear();
+    cells.clear();
+}
+
+sf::Uint64 SpatialGrid::getKey(int x, int y)
+{
+    return (sf::Uint64) (sf::Uint32) x << 32 | (sf::Uint32) y;
+}
+
+sf::IntRect SpatialGrid::getCellRange(const sf::FloatRect &rect) const
+{
+    const auto left = (int) std::floor(rect.left / cellSize);
+    const auto top = (int) std::floor(rect.top / cellSize);
+    const auto right = (int) std::floor((rect.left + rect.width) / cellSize);
+    const auto bottom = (int) std::floor((rect.top + rect.height) / cellSize);
+    return { left, top, right - left + 1, bottom - top + 1 };
+}
+
+void SpatialGrid::addToCells(unsigned long index, const sf::IntRect &range)
+{
+    for (int x = range.left; x < range.left + range.width; x++) {
+        for (int y = range.top; y < range.top + range.height; y++) {
+            std::vector<unsigned long> &cell = cells[getKey(x, y)];
+            cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+        }
+    }
+}
+
+void SpatialGrid::removeFromCells(unsigned long index, const sf::IntRect &range)
+{
+    for (int x = range.left; x < range.left + range.width; x++) {
+        for (int y = range.top; y < range.top + range.height; y++) {
+            auto it = cells.find(getKey(x, y));
+            if (it != cells.end()) {
+                auto indexIt = std::lower_bound(it->second.begin(), it->second.end(), index);
+                if (indexIt != it->second.end() && *indexIt == index) {
+                    it->second.erase(indexIt);
+                }
+                if (it->second.empty()) {
+                    cells.erase(it);
+                }
+            }
+        }
+    }
+}
+
+}
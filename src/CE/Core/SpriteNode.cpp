@@ -1,34 +1,38 @@
 #include <CE/Core/SpriteNode.hpp>
-#include <CE/constant.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <cstdlib>
 
 namespace ce {
 
-SpriteNode::SpriteNode(const sf::Texture &texture, bool isSelectable) : VisualNode(isSelectable)
+SpriteNode::SpriteNode(const sf::Texture &texture, bool isSelectable)
+    : NodeKindTag(Kind::SPRITE), BasicNode(isSelectable)
 {
     sprite.setTexture(texture);
 }
 
-void SpriteNode::setAlpha(float value)
+SpriteNode::SpriteNode(const TextureHandle &texture, bool isSelectable)
+    : NodeKindTag(Kind::SPRITE), BasicNode(isSelectable), textureHandle(texture), isTextureApplied(false)
 {
-    sprite.setColor(sf::Color(sprite.getColor().r, sprite.getColor().g,
-                              sprite.getColor().b, (sf::Uint8) (value * 255)));
+    applyTexture();
 }
 
-float SpriteNode::getWidth()
+void SpriteNode::setAlpha(float value)
 {
-    return sprite.getTexture()->getSize().x;
+    const auto alpha = (sf::Uint8) (value * 255);
+    if (sprite.getColor().a != alpha) {
+        sprite.setColor(sf::Color(sprite.getColor().r, sprite.getColor().g, sprite.getColor().b, alpha));
+        makeChanged();
+    }
 }
 
-float SpriteNode::getHeight()
+float SpriteNode::getWidth()
 {
-    return sprite.getTexture()->getSize().y;
+    return sprite.getTexture() ? std::abs(sprite.getTextureRect().width) : 0;
 }
 
-void SpriteNode::setScale(float value)
+float SpriteNode::getHeight()
 {
-    sprite.setScale(value, value);
-    makeTransformed();
+    return sprite.getTexture() ? std::abs(sprite.getTextureRect().height) : 0;
 }
 
 sf::FloatRect SpriteNode::getRect()
@@ -36,44 +40,45 @@ sf::FloatRect SpriteNode::getRect()
     return sprite.getGlobalBounds();
 }
 
-void SpriteNode::setRotation(float value)
+void SpriteNode::update()
 {
-    sprite.setRotation(value * 180 / MATH_PI);
-    makeTransformed();
+    if (!isTextureApplied) {
+        applyTexture();
+    }
+    VisualNode::update();
 }
 
-void SpriteNode::setOrigin(float x, float y)
+bool SpriteNode::checkBatchable() const
 {
-    sprite.setOrigin(x, y);
-    makeTransformed();
+    return true;
 }
 
-void SpriteNode::setPos(float x, float y)
+const sf::Texture *SpriteNode::getTexture() const
 {
-    sprite.setPosition(x, y);
-    makeTransformed();
+    return sprite.getTexture();
 }
 
-void SpriteNode::rotate(float angle)
+void SpriteNode::writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const
 {
-    sprite.rotate(angle * 180 / MATH_PI);
-    makeTransformed();
+    fillQuad(vertices, transform * sprite.getTransform(), sprite.getLocalBounds(), sprite.getTextureRect(), sprite.getColor());
 }
 
-void SpriteNode::move(float offsetX, float offsetY)
-{
-    sprite.move(offsetX, offsetY);
-    makeTransformed();
-}
-
-const sf::Transformable &SpriteNode::getTransformable() const
+const sf::Drawable &SpriteNode::getDrawable() const
 {
     return sprite;
 }
 
-const sf::Drawable &SpriteNode::getDrawable() const
+void SpriteNode::applyTexture()
 {
-    return sprite;
+    if (!textureHandle.checkLoaded()) {
+        return;
+    }
+    isTextureApplied = true;
+    sprite.setTexture(*textureHandle.getTexture());
+    sprite.setTextureRect(textureHandle.getTextureRect());
+    makeChanged();
+    makeRectChanged();
+    onDescendantsChanged();
 }
 
 }
@@ -1,6 +1,8 @@
 #include <CE/Core/Stage.hpp>
 #include <CE/Core/Act.hpp>
-#include <SFML/Window/Event.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Resource/ResourceManager.hpp>
+#include <SFML/Window/Mouse.hpp>
 
 namespace ce {
 
@@ -11,59 +13,146 @@ Stage::Stage(const sf::VideoMode &mode, const sf::String &title, sf::Uint32 styl
     setView(view);
 }
 
-void Stage::setAct(const std::shared_ptr<Act> &value)
+Stage::~Stage()
 {
-    act = value;
+    stopRenderThread();
 }
 
-const std::shared_ptr<Act> &Stage::getAct() const
+sf::Vector2u Stage::getSize() const
 {
-    return act;
+    return sf::RenderWindow::getSize();
 }
 
-void Stage::start()
+sf::Vector2i Stage::getMousePosition() const
 {
-    while (isOpen()) {
-        update();
+    return sf::Mouse::getPosition(*this);
+}
+
+sf::RenderTarget *Stage::getRenderTarget()
+{
+    return this;
+}
+
+void Stage::enableRenderThread()
+{
+    isRenderThreadEnabled = true;
+}
+
+void Stage::disableRenderThread()
+{
+    isRenderThreadEnabled = false;
+}
+
+bool Stage::checkRunning() const
+{
+    return isOpen() && BaseStage::checkRunning();
+}
+
+void Stage::prepareFrame()
+{
+    if (isRenderThreadEnabled != renderThread.joinable()) {
+        isRenderThreadEnabled ? startRenderThread() : stopRenderThread();
     }
 }
 
-void Stage::update()
-{
-    onUpdated();
-
-    auto event = sf::Event();
-    while (pollEvent(event)) {
-        if (event.type == sf::Event::Resized) {
-            view.reset(sf::FloatRect(0, 0, event.size.width, event.size.height));
-            setView(view);
-            act->setUpNodes();
-        } else if (event.type == sf::Event::MouseMoved) {
-            act->onMouseMoved(sf::Vector2i(event.mouseMove.x, event.mouseMove.y));
-        } else if (event.type == sf::Event::MouseLeft) {
-            act->onMouseLeft();
-        } else if (event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                act->onLeftMouseButtonPressed();
-            } else if (event.mouseButton.button == sf::Mouse::Right) {
-                act->onRightMouseButtonPressed();
-            }
-        } else if (event.type == sf::Event::MouseButtonReleased) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                act->onLeftMouseButtonReleased();
-            } else if (event.mouseButton.button == sf::Mouse::Right) {
-                act->onRightMouseButtonReleased();
+bool Stage::pollInputEvent(sf::Event &event)
+{
+    return pollEvent(event) || BaseStage::pollInputEvent(event);
+}
+
+void Stage::onResized(const sf::Vector2u &size)
+{
+    view.reset(sf::FloatRect(0, 0, size.x, size.y));
+    if (!renderThread.joinable()) {
+        setView(view);
+    }
+}
+
+void Stage::onClosed()
+{
+    stopRenderThread();
+    close();
+}
+
+void Stage::drawFrame()
+{
+    if (!renderThread.joinable()) {
+        clear(act->getBgColor());
+        act->draw(*this);
+        Profiler::finishPhase(Profiler::Phase::DRAW);
+        display();
+        Profiler::finishPhase(Profiler::Phase::DISPLAY);
+        return;
+    }
+
+    DrawList &list = drawLists[recordedListIndex];
+    list.reset(view, act->getBgColor());
+    act->draw(list);
+    Profiler::finishPhase(Profiler::Phase::DRAW);
+    {
+        std::unique_lock<std::mutex> lock(renderMutex);
+        renderCondition.wait(lock, [this]() -> bool { return !submittedList && !isRendering; });
+        submittedList = &list;
+    }
+    renderCondition.notify_all();
+    recordedListIndex = 1 - recordedListIndex;
+    Profiler::finishPhase(Profiler::Phase::DISPLAY);
+}
+
+void Stage::stopRendering()
+{
+    stopRenderThread();
+}
+
+void Stage::startRenderThread()
+{
+    setActive(false);
+    isRenderStopped = false;
+    renderThread = std::thread(&Stage::render, this);
+}
+
+void Stage::stopRenderThread()
+{
+    if (!renderThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(renderMutex);
+        isRenderStopped = true;
+    }
+    renderCondition.notify_all();
+    renderThread.join();
+    setActive(true);
+    setView(view);
+}
+
+void Stage::render()
+{
+    setActive(true);
+    while (true) {
+        DrawList *list;
+        {
+            std::unique_lock<std::mutex> lock(renderMutex);
+            renderCondition.wait(lock, [this]() -> bool { return submittedList || isRenderStopped; });
+            if (!submittedList) {
+                break;
             }
-        } else if (event.type == sf::Event::KeyReleased) {
-            act->onKeyReleased(event.key.code);
-        } else if (event.type == sf::Event::Closed) {
-            close();
+            list = submittedList;
+            submittedList = nullptr;
+            isRendering = true;
         }
+        {
+            std::lock_guard<std::recursive_mutex> textureLock(ResourceManager::getTextureMutex());
+            list->drawToTarget(*this);
+            display();
+        }
+        {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            isRendering = false;
+        }
+        renderCondition.notify_all();
     }
-
-    clear(act->getBgColor());
-    act->update();
-    display();
+    setActive(false);
 }
 
 }
@@ -0,0 +1,42 @@
+#include <CE/Core/TextureStage.hpp>
+#include <CE/Core/Act.hpp>
+#include <CE/Core/Profiler.hpp>
+
+namespace ce {
+
+TextureStage::TextureStage(const sf::Vector2u &size) : HeadlessStage(size)
+{
+    texture.create(size.x, size.y);
+}
+
+sf::RenderTarget *TextureStage::getRenderTarget()
+{
+    return &texture;
+}
+
+const sf::Texture &TextureStage::getTexture() const
+{
+    return texture.getTexture();
+}
+
+sf::Image TextureStage::capture() const
+{
+    return texture.getTexture().copyToImage();
+}
+
+void TextureStage::onResized(const sf::Vector2u &value)
+{
+    HeadlessStage::onResized(value);
+    texture.create(value.x, value.y);
+}
+
+void TextureStage::drawFrame()
+{
+    texture.clear(act->getBgColor());
+    act->draw(texture);
+    Profiler::finishPhase(Profiler::Phase::DRAW);
+    texture.display();
+    Profiler::finishPhase(Profiler::Phase::DISPLAY);
+}
+
+}
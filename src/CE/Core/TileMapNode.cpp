@@ -0,0 +1,204 @@
+#include <CE/Core/TileMapNode.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ce {
+
+constexpr int TileMapNode::EMPTY_TILE;
+constexpr unsigned int TileMapNode::CHUNK_SIZE;
+
+TileMapNode::TileMapNode(const sf::Texture &tileset, const sf::Vector2u &tileSize,
+                         unsigned int columnCount, unsigned int rowCount, bool isSelectable)
+    : BasicNode(isSelectable), tileset(tileset), tileSize(tileSize), columnCount(columnCount), rowCount(rowCount),
+      chunkColumnCount((columnCount + CHUNK_SIZE - 1) / CHUNK_SIZE),
+      tiles(columnCount * rowCount, EMPTY_TILE),
+      chunks(chunkColumnCount * ((rowCount + CHUNK_SIZE - 1) / CHUNK_SIZE), { sf::VertexArray(sf::Triangles), true }) {}
+
+void TileMapNode::onMouseMoved(const sf::Vector2i &mousePosition)
+{
+    hoveredTile = getTileCoordinates(mousePosition);
+}
+
+void TileMapNode::onMouseLeft()
+{
+    hoveredTile = sf::Vector2i(-1, -1);
+}
+
+unsigned int TileMapNode::getColumnCount() const
+{
+    return columnCount;
+}
+
+unsigned int TileMapNode::getRowCount() const
+{
+    return rowCount;
+}
+
+int TileMapNode::getTile(unsigned int column, unsigned int row) const
+{
+    return tiles[row * columnCount + column];
+}
+
+void TileMapNode::setTile(unsigned int column, unsigned int row, int value)
+{
+    int &tile = tiles[row * columnCount + column];
+    if (tile != value) {
+        tile = value;
+        chunks[(row / CHUNK_SIZE) * chunkColumnCount + column / CHUNK_SIZE].isChanged = true;
+        makeChanged();
+    }
+}
+
+void TileMapNode::setTiles(const std::vector<int> &value)
+{
+    tiles = value;
+    tiles.resize(columnCount * rowCount, EMPTY_TILE);
+    makeChunksChanged();
+}
+
+const sf::Vector2i &TileMapNode::getHoveredTile() const
+{
+    return hoveredTile;
+}
+
+sf::Vector2i TileMapNode::getTileCoordinates(const sf::Vector2i &point)
+{
+    const sf::Vector2f localPoint = getCombinedTransform().getInverse().transformPoint(point.x, point.y);
+    if (localPoint.x < 0 || localPoint.y < 0) {
+        return sf::Vector2i(-1, -1);
+    }
+    const unsigned int column = static_cast<unsigned int>(localPoint.x / tileSize.x);
+    const unsigned int row = static_cast<unsigned int>(localPoint.y / tileSize.y);
+    if (column >= columnCount || row >= rowCount) {
+        return sf::Vector2i(-1, -1);
+    }
+    return sf::Vector2i(column, row);
+}
+
+void TileMapNode::setAlpha(float value)
+{
+    const auto alpha = static_cast<sf::Uint8>(value * 255);
+    if (color.a != alpha) {
+        color.a = alpha;
+        makeChunksChanged();
+    }
+}
+
+float TileMapNode::getWidth()
+{
+    return columnCount * tileSize.x;
+}
+
+float TileMapNode::getHeight()
+{
+    return rowCount * tileSize.y;
+}
+
+sf::FloatRect TileMapNode::getRect()
+{
+    return transformable.getTransform().transformRect(sf::FloatRect(0, 0, getWidth(), getHeight()));
+}
+
+void TileMapNode::drawToTarget(sf::RenderTarget &target)
+{
+    const sf::IntRect visibleChunks = getVisibleChunks(target.getView());
+    sf::RenderStates states(&tileset);
+    states.transform = getCombinedTransform();
+    for (int chunkRow = visibleChunks.top; chunkRow < visibleChunks.top + visibleChunks.height; chunkRow++) {
+        for (int chunkColumn = visibleChunks.left; chunkColumn < visibleChunks.left + visibleChunks.width;
+             chunkColumn++) {
+            buildChunk(chunkColumn, chunkRow);
+            const sf::VertexArray &vertices = chunks[chunkRow * chunkColumnCount + chunkColumn].vertices;
+            if (vertices.getVertexCount() > 0) {
+                target.draw(vertices, states);
+                Profiler::countDrawCall();
+            }
+        }
+    }
+    Node::drawToTarget(target);
+}
+
+void TileMapNode::drawToList(DrawList &list)
+{
+    const sf::IntRect visibleChunks = getVisibleChunks(list.getView());
+    for (int chunkRow = visibleChunks.top; chunkRow < visibleChunks.top + visibleChunks.height; chunkRow++) {
+        for (int chunkColumn = visibleChunks.left; chunkColumn < visibleChunks.left + visibleChunks.width;
+             chunkColumn++) {
+            buildChunk(chunkColumn, chunkRow);
+            list.addVertices(chunks[chunkRow * chunkColumnCount + chunkColumn].vertices, &tileset,
+                             getCombinedTransform());
+        }
+    }
+    Node::drawToList(list);
+}
+
+bool TileMapNode::checkPointOnIt(const sf::Vector2i &point)
+{
+    const sf::Vector2i tile = getTileCoordinates(point);
+    return tile.x != -1 && getTile(tile.x, tile.y) != EMPTY_TILE;
+}
+
+const sf::Drawable &TileMapNode::getDrawable() const
+{
+    return chunks.front().vertices;
+}
+
+sf::IntRect TileMapNode::getVisibleChunks(const sf::View &view)
+{
+    const sf::FloatRect viewRect = view.getInverseTransform().transformRect(sf::FloatRect(-1, -1, 2, 2));
+    const sf::FloatRect localRect = getCombinedTransform().getInverse().transformRect(viewRect);
+    const float chunkWidth = static_cast<float>(CHUNK_SIZE * tileSize.x);
+    const float chunkHeight = static_cast<float>(CHUNK_SIZE * tileSize.y);
+    const int chunkRowCount = static_cast<int>(chunks.size() / chunkColumnCount);
+    const int left = std::max(0, static_cast<int>(std::floor(localRect.left / chunkWidth)));
+    const int top = std::max(0, static_cast<int>(std::floor(localRect.top / chunkHeight)));
+    const int right = std::min(static_cast<int>(chunkColumnCount),
+                               static_cast<int>(std::ceil((localRect.left + localRect.width) / chunkWidth)));
+    const int bottom = std::min(chunkRowCount,
+                                static_cast<int>(std::ceil((localRect.top + localRect.height) / chunkHeight)));
+    return sf::IntRect(left, top, std::max(0, right - left), std::max(0, bottom - top));
+}
+
+void TileMapNode::buildChunk(unsigned int chunkColumn, unsigned int chunkRow)
+{
+    Chunk &chunk = chunks[chunkRow * chunkColumnCount + chunkColumn];
+    if (!chunk.isChanged) {
+        return;
+    }
+    chunk.isChanged = false;
+    chunk.vertices.clear();
+
+    const unsigned int tilesetColumnCount = std::max(1u, tileset.getSize().x / tileSize.x);
+    const unsigned int firstColumn = chunkColumn * CHUNK_SIZE;
+    const unsigned int firstRow = chunkRow * CHUNK_SIZE;
+    const unsigned int lastColumn = std::min(columnCount, firstColumn + CHUNK_SIZE);
+    const unsigned int lastRow = std::min(rowCount, firstRow + CHUNK_SIZE);
+    sf::Vertex quad[QUAD_VERTEX_COUNT];
+    for (unsigned int row = firstRow; row < lastRow; row++) {
+        for (unsigned int column = firstColumn; column < lastColumn; column++) {
+            const int tile = tiles[row * columnCount + column];
+            if (tile == EMPTY_TILE) {
+                continue;
+            }
+            const sf::FloatRect rect(column * tileSize.x, row * tileSize.y, tileSize.x, tileSize.y);
+            const sf::IntRect textureRect((tile % tilesetColumnCount) * tileSize.x,
+                                          (tile / tilesetColumnCount) * tileSize.y, tileSize.x, tileSize.y);
+            fillQuad(quad, sf::Transform::Identity, rect, textureRect, color);
+            for (const sf::Vertex &vertex : quad) {
+                chunk.vertices.append(vertex);
+            }
+        }
+    }
+}
+
+void TileMapNode::makeChunksChanged()
+{
+    for (auto &chunk : chunks) {
+        chunk.isChanged = true;
+    }
+    makeChanged();
+}
+
+}
@@ -0,0 +1,117 @@
+#include <CE/Core/TransformStore.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Core/TransformableNode.hpp>
+
+namespace ce {
+
+TransformStore::TransformStore(TransformableNode &owner) : owner(owner) {}
+
+TransformStore::~TransformStore()
+{
+    invalidate();
+}
+
+const sf::Transform &TransformStore::getCombinedTransform(unsigned long index)
+{
+    if (checkedGeneration != TransformableNode::getTransformGeneration()) {
+        checkedGeneration = TransformableNode::getTransformGeneration();
+        if (checkChanged()) {
+            update();
+        }
+    }
+    return combinedTransforms[index];
+}
+
+void TransformStore::setLocalTransform(unsigned long index, const sf::Transform &transform)
+{
+    localTransforms[index] = transform;
+}
+
+void TransformStore::build()
+{
+    invalidate();
+    collect(owner, -1);
+    isBuilt = true;
+    combinedTransforms.resize(nodes.size());
+    checkedGeneration = 0;
+    isUpdated = false;
+}
+
+void TransformStore::invalidate()
+{
+    if (!isBuilt) {
+        return;
+    }
+    isBuilt = false;
+    for (auto node : nodes) {
+        if (node) {
+            node->store = nullptr;
+            node->isTransformed = true;
+            node->checkedGeneration = 0;
+        }
+    }
+    nodes.clear();
+    parents.clear();
+    localTransforms.clear();
+    combinedTransforms.clear();
+}
+
+void TransformStore::releaseNode(unsigned long index)
+{
+    nodes[index] = nullptr;
+}
+
+void TransformStore::collect(TransformableNode &node, long parent)
+{
+    const auto index = (long) nodes.size();
+    node.store = this;
+    node.storeIndex = (unsigned long) index;
+    nodes.push_back(&node);
+    parents.push_back(parent);
+    localTransforms.push_back(node.getTransformable().getTransform());
+
+    for (auto &child : node.children) {
+        if (child && !child->transformStore) {
+            collect(*child, index);
+        }
+    }
+}
+
+bool TransformStore::checkChanged()
+{
+    // Only the owner's subtree and its parent's combined transform feed the store.
+    unsigned long parentVersion = 0;
+    Node *parent = owner.getParent();
+    if (parent) {
+        parent->getCombinedTransform();
+        parentVersion = parent->combinedVersion;
+    }
+    const unsigned long version = owner.transformVersion + owner.getDescendantsTransformVersion();
+    if (isUpdated && version == checkedVersion && parentVersion == checkedParentVersion) {
+        return false;
+    }
+    isUpdated = true;
+    checkedVersion = version;
+    checkedParentVersion = parentVersion;
+    return true;
+}
+
+void TransformStore::update()
+{
+    if (owner.getParent()) {
+        combinedTransforms[0] = owner.getParent()->getCombinedTransform() * localTransforms[0];
+    } else {
+        combinedTransforms[0] = localTransforms[0];
+    }
+    for (unsigned long i = 1; i < combinedTransforms.size(); i++) {
+        combinedTransforms[i] = combinedTransforms[parents[i]] * localTransforms[i];
+    }
+    for (auto node : nodes) {
+        if (node) {
+            node->combinedVersion++;
+        }
+    }
+    Profiler::countTransform(combinedTransforms.size());
+}
+
+}
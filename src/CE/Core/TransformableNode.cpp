@@ -1,10 +1,20 @@
 #include <CE/Core/TransformableNode.hpp>
+#include <CE/Core/Profiler.hpp>
 #include <CE/constant.hpp>
 
 namespace ce {
 
+std::atomic<unsigned long> TransformableNode::transformGeneration(1);
+
 TransformableNode::TransformableNode(bool isSelectable) : Node(isSelectable) {}
 
+TransformableNode::~TransformableNode()
+{
+    if (store) {
+        store->releaseNode(storeIndex);
+    }
+}
+
 float TransformableNode::getHalfX()
 {
     return getWidth() / 2;
@@ -74,15 +84,46 @@ const sf::Vector2f& TransformableNode::getPos() const
     return getTransformable().getPosition();
 }
 
+unsigned long TransformableNode::getTransformGeneration()
+{
+    return transformGeneration;
+}
+
+unsigned long TransformableNode::getTransformVersion() const
+{
+    return transformVersion;
+}
+
 const sf::Transform &TransformableNode::getCombinedTransform()
 {
-    if (isTransformed) {
-        isTransformed = false;
-        if (getParent()) {
-            combinedTransform = getParent()->getCombinedTransform() * getTransformable().getTransform();
-        } else {
-            combinedTransform = getTransformable().getTransform();
+    if (store) {
+        return store->getCombinedTransform(storeIndex);
+    }
+    if (transformStore) {
+        transformStore->build();
+        return transformStore->getCombinedTransform(0);
+    }
+
+    if (checkedGeneration == transformGeneration) {
+        return combinedTransform;
+    }
+    checkedGeneration = transformGeneration;
+
+    Node *parent = getParent();
+    if (parent) {
+        const sf::Transform &parentTransform = parent->getCombinedTransform();
+        if (isTransformed || parentVersion != parent->combinedVersion) {
+            Profiler::countTransform();
+            combinedTransform = parentTransform * getTransformable().getTransform();
+            parentVersion = parent->combinedVersion;
+            isTransformed = false;
+            combinedVersion++;
         }
+    } else if (isTransformed) {
+        Profiler::countTransform();
+        combinedTransform = getTransformable().getTransform();
+        isTransformed = false;
+        combinedVersion++;
     }
     return combinedTransform;
 }
@@ -97,11 +138,36 @@ void TransformableNode::moveY(float offset)
     move(0, offset);
 }
 
+TransformableNode::Kind TransformableNode::getKind() const
+{
+    return kind;
+}
+
 void TransformableNode::removeFromParent()
 {
     getParent()->removeChild(castSharedFromThis<TransformableNode>());
 }
 
+void TransformableNode::enableTransformStore()
+{
+    transformStore.reset(new TransformStore(*this));
+    onDescendantsChanged();
+}
+
+void TransformableNode::disableTransformStore()
+{
+    transformStore.reset();
+    onDescendantsChanged();
+}
+
+void TransformableNode::onDescendantsChanged()
+{
+    if (transformStore) {
+        transformStore->invalidate();
+    }
+    Node::onDescendantsChanged();
+}
+
 bool TransformableNode::checkPointOnIt(const sf::Vector2i &point)
 {
     sf::Vector2f localPoint = translatePointToLocalCoordinates(point);
@@ -118,8 +184,27 @@ sf::Vector2f TransformableNode::translatePointToLocalCoordinates(const sf::Vecto
 void TransformableNode::makeTransformed()
 {
     isTransformed = true;
-    for (auto &child : children) {
-        child->makeTransformed();
+    transformVersion++;
+    transformGeneration++;
+    for (Node *ancestor = getParent(); ancestor; ancestor = ancestor->parent) {
+        ancestor->descendantsTransformVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (store) {
+        store->setLocalTransform(storeIndex, getTransformable().getTransform());
+    }
+    makeRectChanged();
+}
+
+void TransformableNode::makeRectChanged()
+{
+    if (!getParent()) {
+        return;
+    }
+    getParent()->makeChildrenRectChanged();
+    if (getParent()->isUpdatingInParallel) {
+        isRectChangePending = true;
+    } else {
+        getParent()->onChildRectChanged(*this);
     }
 }
 
@@ -1,13 +1,87 @@
 #include <CE/Core/VisualNode.hpp>
+#include <CE/Core/BatchNode.hpp>
+#include <CE/Core/DrawList.hpp>
+#include <CE/Core/Profiler.hpp>
 
 namespace ce {
 
+constexpr unsigned long VisualNode::QUAD_VERTEX_COUNT;
+
 VisualNode::VisualNode(bool isSelectable) : TransformableNode(isSelectable) {}
 
+VisualNode::~VisualNode()
+{
+    if (batch) {
+        batch->releaseSlot(batchSlot);
+    }
+}
+
 void VisualNode::drawToTarget(sf::RenderTarget &target)
 {
-    target.draw(getDrawable(), getParent()->getCombinedTransform());
+    if (!batch || !batch->isDrawing) {
+        target.draw(getDrawable(), getParent()->getCombinedTransform());
+        Profiler::countDrawCall();
+    }
     Node::drawToTarget(target);
 }
 
+void VisualNode::drawToList(DrawList &list)
+{
+    if (!batch || !batch->isDrawing) {
+        const sf::Transform &transform = getParent()->getCombinedTransform();
+        if (checkBatchable()) {
+            writeVertices(list.addVertices(getTexture(), getVertexCount()), transform);
+        } else {
+            std::unique_ptr<sf::Drawable> drawable = copyDrawable();
+            if (drawable) {
+                list.addDrawable(std::move(drawable), transform);
+            }
+        }
+    }
+    Node::drawToList(list);
+}
+
+void VisualNode::makeChanged()
+{
+    for (Node *ancestor = getParent(); ancestor; ancestor = ancestor->parent) {
+        ancestor->descendantsChangeVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!batch) {
+        return;
+    }
+    if (checkInParallelUpdate()) {
+        batch->deferSlotChange(batchSlot);
+    } else {
+        batch->makeSlotChanged(batchSlot);
+    }
+}
+
+void VisualNode::collectBatched(BatchNode &batch)
+{
+    if (checkBatchable()) {
+        batch.addSlot(*this);
+    }
+    TransformableNode::collectBatched(batch);
+}
+
+void VisualNode::fillQuad(sf::Vertex *quad, const sf::Transform &transform, const sf::FloatRect &rect,
+                          const sf::IntRect &textureRect, const sf::Color &color)
+{
+    const sf::Vector2f topLeft = transform.transformPoint(rect.left, rect.top);
+    const sf::Vector2f topRight = transform.transformPoint(rect.left + rect.width, rect.top);
+    const sf::Vector2f bottomLeft = transform.transformPoint(rect.left, rect.top + rect.height);
+    const sf::Vector2f bottomRight = transform.transformPoint(rect.left + rect.width, rect.top + rect.height);
+    const auto left = static_cast<float>(textureRect.left);
+    const auto top = static_cast<float>(textureRect.top);
+    const auto right = static_cast<float>(textureRect.left + textureRect.width);
+    const auto bottom = static_cast<float>(textureRect.top + textureRect.height);
+
+    quad[0] = sf::Vertex(topLeft, color, sf::Vector2f(left, top));
+    quad[1] = sf::Vertex(topRight, color, sf::Vector2f(right, top));
+    quad[2] = sf::Vertex(bottomLeft, color, sf::Vector2f(left, bottom));
+    quad[3] = quad[2];
+    quad[4] = quad[1];
+    quad[5] = sf::Vertex(bottomRight, color, sf::Vector2f(right, bottom));
+}
+
 }
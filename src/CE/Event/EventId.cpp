@@ -0,0 +1,57 @@
+#include <CE/Event/EventId.hpp>
+#include <CE/constant.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace ce {
+
+namespace {
+
+struct EventRegistry
+{
+    std::vector<std::string> names;
+    std::unordered_map<std::string, EventId> ids;
+
+    EventRegistry()
+    {
+        add("click", CLICK);
+    }
+
+    void add(const std::string &name, EventId event)
+    {
+        if (names.size() <= event) {
+            names.resize(event + 1);
+        }
+        names[event] = name;
+        ids[name] = event;
+    }
+};
+
+EventRegistry &getRegistry()
+{
+    static EventRegistry registry;
+    return registry;
+}
+
+}
+
+EventId registerEvent(const std::string &name)
+{
+    EventRegistry &registry = getRegistry();
+    auto it = registry.ids.find(name);
+    if (it != registry.ids.end()) {
+        return it->second;
+    }
+    const auto event = static_cast<EventId>(registry.names.size());
+    registry.add(name, event);
+    return event;
+}
+
+const std::string &getEventName(EventId event)
+{
+    static const std::string unknownName;
+    const EventRegistry &registry = getRegistry();
+    return event < registry.names.size() ? registry.names[event] : unknownName;
+}
+
+}
@@ -0,0 +1,31 @@
+#include <CE/Event/EventQueue.hpp>
+#include <CE/Event/Speaker.hpp>
+
+namespace ce {
+
+std::vector<EventQueue::Entry> EventQueue::entries;
+std::vector<EventQueue::Entry> EventQueue::flushedEntries;
+std::mutex EventQueue::mutex;
+
+void EventQueue::post(const std::shared_ptr<Speaker> &speaker, EventId event)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_back({ speaker, event });
+}
+
+void EventQueue::flush()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushedEntries.swap(entries);
+    }
+    for (auto &entry : flushedEntries) {
+        const std::shared_ptr<Speaker> speaker = entry.speaker.lock();
+        if (speaker) {
+            speaker->declareEvent(entry.event);
+        }
+    }
+    flushedEntries.clear();
+}
+
+}
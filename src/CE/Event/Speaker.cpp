@@ -1,18 +1,73 @@
 #include <CE/Event/Speaker.hpp>
+#include <CE/Event/EventQueue.hpp>
+#include <algorithm>
 
 namespace ce {
 
-Speaker::Speaker(const std::shared_ptr<Listener> &listener) : listener(listener) {}
+Speaker::Speaker(const std::shared_ptr<Listener> &listener)
+{
+    if (listener) {
+        addListener(listener);
+    }
+}
 
 void Speaker::setListener(const std::shared_ptr<Listener> &value)
 {
-    listener = value;
+    for (auto &subscriber : subscribers) {
+        subscriber.listener.reset();
+    }
+    if (value) {
+        addListener(value);
+    }
+    removeExpiredSubscribers();
+}
+
+void Speaker::addListener(const std::shared_ptr<Listener> &value, EventId event)
+{
+    subscribers.push_back({ value, event });
+}
+
+void Speaker::removeListener(const std::shared_ptr<Listener> &value)
+{
+    for (auto &subscriber : subscribers) {
+        if (subscriber.listener.lock() == value) {
+            subscriber.listener.reset();
+        }
+    }
+    removeExpiredSubscribers();
+}
+
+void Speaker::declareEvent(EventId event)
+{
+    if (subscribers.empty()) {
+        return;
+    }
+
+    const std::shared_ptr<Speaker> speaker = sharedFromThis();
+    dispatchDepth++;
+    const unsigned long subscriberCount = subscribers.size();
+    for (unsigned long i = 0; i < subscriberCount; i++) {
+        if (subscribers[i].event == ANY_EVENT || subscribers[i].event == event) {
+            const std::shared_ptr<Listener> listener = subscribers[i].listener.lock();
+            if (listener) {
+                listener->onEvent(speaker, event);
+            }
+        }
+    }
+    dispatchDepth--;
+    removeExpiredSubscribers();
+}
+
+void Speaker::postEvent(EventId event)
+{
+    EventQueue::post(sharedFromThis(), event);
 }
 
-void Speaker::declareEvent(const sf::String &name)
+void Speaker::removeExpiredSubscribers()
 {
-    if (!listener.expired()) {
-        listener.lock()->onEvent(sharedFromThis(), name);
+    if (dispatchDepth == 0) {
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), [](const Subscriber &subscriber)
+            -> bool { return subscriber.listener.expired(); }), subscribers.end());
     }
 }
 
@@ -0,0 +1,24 @@
+#include <CE/Resource/FontHandle.hpp>
+
+namespace ce {
+
+FontHandle::FontHandle() = default;
+
+FontHandle::FontHandle(const std::shared_ptr<Entry> &entry) : entry(entry) {}
+
+bool FontHandle::checkLoaded() const
+{
+    return entry && entry->isLoaded;
+}
+
+bool FontHandle::checkFailed() const
+{
+    return entry && entry->isFailed;
+}
+
+const sf::Font *FontHandle::getFont() const
+{
+    return checkLoaded() ? &entry->font : nullptr;
+}
+
+}
@@ -0,0 +1,250 @@
+#include <CE/Resource/ResourceManager.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <thread>
+
+namespace ce {
+
+class ResourceManager::Loader
+{
+public:
+    typedef std::function<void()> Completion;
+    typedef std::function<Completion()> Job;
+
+    Loader() : thread(&Loader::run, this) {}
+
+    ~Loader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopped = true;
+        }
+        jobCondition.notify_one();
+        thread.join();
+    }
+
+    unsigned long getPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pendingCount;
+    }
+
+    void post(const Job &job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(job);
+            pendingCount++;
+        }
+        jobCondition.notify_one();
+    }
+
+    void flush()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            flushedCompletions.swap(completions);
+            pendingCount -= flushedCompletions.size();
+        }
+        if (flushedCompletions.empty()) {
+            return;
+        }
+        std::lock_guard<std::recursive_mutex> lock(getTextureMutex());
+        for (auto &completion : flushedCompletions) {
+            completion();
+        }
+        flushedCompletions.clear();
+    }
+
+    void finish()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            completionCondition.wait(lock, [this]() -> bool { return completions.size() == pendingCount; });
+        }
+        flush();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable jobCondition;
+    std::condition_variable completionCondition;
+    std::deque<Job> jobs;
+    std::vector<Completion> completions;
+    std::vector<Completion> flushedCompletions;
+    unsigned long pendingCount = 0;
+    bool isStopped = false;
+    std::thread thread;
+
+    void run()
+    {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobCondition.wait(lock, [this]() -> bool { return isStopped || !jobs.empty(); });
+                if (isStopped) {
+                    return;
+                }
+                job = jobs.front();
+                jobs.pop_front();
+            }
+            const Completion completion = job();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                completions.push_back(completion);
+            }
+            completionCondition.notify_one();
+        }
+    }
+};
+
+constexpr unsigned int ResourceManager::ATLAS_SIZE;
+constexpr unsigned int ResourceManager::ATLAS_PADDING;
+constexpr unsigned int ResourceManager::PACKED_SIZE_LIMIT;
+std::map<std::string, std::shared_ptr<TextureHandle::Entry> > ResourceManager::textures;
+std::map<std::string, std::shared_ptr<FontHandle::Entry> > ResourceManager::fonts;
+std::vector<std::unique_ptr<ResourceManager::AtlasPage> > ResourceManager::atlasPages;
+std::unique_ptr<ResourceManager::Loader> ResourceManager::loader;
+
+TextureHandle ResourceManager::loadTexture(const std::string &filename, bool isPacked)
+{
+    std::shared_ptr<TextureHandle::Entry> &entry = textures[filename];
+    if (!entry) {
+        entry = std::make_shared<TextureHandle::Entry>();
+        entry->isPacked = isPacked;
+        const std::shared_ptr<TextureHandle::Entry> loadedEntry = entry;
+        getLoader().post([loadedEntry, filename]() -> Loader::Completion {
+            const bool isDecoded = loadedEntry->image.loadFromFile(filename);
+            return [loadedEntry, isDecoded]() {
+                if (isDecoded) {
+                    uploadTexture(*loadedEntry);
+                } else {
+                    loadedEntry->isFailed = true;
+                }
+            };
+        });
+    }
+    return TextureHandle(entry);
+}
+
+FontHandle ResourceManager::loadFont(const std::string &filename)
+{
+    std::shared_ptr<FontHandle::Entry> &entry = fonts[filename];
+    if (!entry) {
+        entry = std::make_shared<FontHandle::Entry>();
+        const std::shared_ptr<FontHandle::Entry> loadedEntry = entry;
+        getLoader().post([loadedEntry, filename]() -> Loader::Completion {
+            const bool isLoaded = loadedEntry->font.loadFromFile(filename);
+            return [loadedEntry, isLoaded]() {
+                loadedEntry->isLoaded = isLoaded;
+                loadedEntry->isFailed = !isLoaded;
+            };
+        });
+    }
+    return FontHandle(entry);
+}
+
+unsigned long ResourceManager::getPendingCount()
+{
+    return loader ? loader->getPendingCount() : 0;
+}
+
+void ResourceManager::flush()
+{
+    if (loader) {
+        loader->flush();
+    }
+}
+
+void ResourceManager::finishLoading()
+{
+    if (loader) {
+        loader->finish();
+    }
+}
+
+void ResourceManager::releaseUnused()
+{
+    for (auto it = textures.begin(); it != textures.end();) {
+        it = it->second.use_count() == 1 ? textures.erase(it) : std::next(it);
+    }
+    for (auto it = fonts.begin(); it != fonts.end();) {
+        it = it->second.use_count() == 1 ? fonts.erase(it) : std::next(it);
+    }
+}
+
+std::recursive_mutex &ResourceManager::getTextureMutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+ResourceManager::Loader &ResourceManager::getLoader()
+{
+    if (!loader) {
+        loader.reset(new Loader());
+    }
+    return *loader;
+}
+
+void ResourceManager::uploadTexture(TextureHandle::Entry &entry)
+{
+    const sf::Vector2u size = entry.image.getSize();
+    const bool isPackable = entry.isPacked && size.x <= PACKED_SIZE_LIMIT && size.y <= PACKED_SIZE_LIMIT;
+    if (!isPackable || !packTexture(entry)) {
+        entry.ownTexture.reset(new sf::Texture());
+        if (!entry.ownTexture->loadFromImage(entry.image)) {
+            entry.ownTexture.reset();
+            entry.isFailed = true;
+            entry.image = sf::Image();
+            return;
+        }
+        entry.texture = entry.ownTexture.get();
+        entry.textureRect = sf::IntRect(0, 0, size.x, size.y);
+    }
+    entry.isLoaded = true;
+    entry.image = sf::Image();
+}
+
+bool ResourceManager::packTexture(TextureHandle::Entry &entry)
+{
+    if (!atlasPages.empty() && packIntoPage(*atlasPages.back(), entry)) {
+        return true;
+    }
+
+    std::unique_ptr<AtlasPage> page(new AtlasPage());
+    page->size = std::min(ATLAS_SIZE, sf::Texture::getMaximumSize());
+    if (!page->texture.create(page->size, page->size)) {
+        return false;
+    }
+    atlasPages.push_back(std::move(page));
+    return packIntoPage(*atlasPages.back(), entry);
+}
+
+bool ResourceManager::packIntoPage(AtlasPage &page, TextureHandle::Entry &entry)
+{
+    const sf::Vector2u size = entry.image.getSize();
+    const unsigned int width = size.x + ATLAS_PADDING;
+    const unsigned int height = size.y + ATLAS_PADDING;
+    if (page.shelfX + width > page.size) {
+        page.shelfX = 0;
+        page.shelfY += page.shelfHeight;
+        page.shelfHeight = 0;
+    }
+    if (page.shelfX + width > page.size || page.shelfY + height > page.size) {
+        return false;
+    }
+
+    page.texture.update(entry.image, page.shelfX, page.shelfY);
+    entry.texture = &page.texture;
+    entry.textureRect = sf::IntRect(page.shelfX, page.shelfY, size.x, size.y);
+    page.shelfX += width;
+    page.shelfHeight = std::max(page.shelfHeight, height);
+    return true;
+}
+
+}
@@ -0,0 +1,206 @@
+#include <CE/Resource/Scene.hpp>
+#include <CE/Core/CircleNode.hpp>
+#include <CE/Core/RectangleNode.hpp>
+#include <CE/UI/Text.hpp>
+#include <algorithm>
+
+namespace ce {
+
+const std::shared_ptr<MimicNode> &Scene::getRoot() const
+{
+    return root;
+}
+
+unsigned long Scene::getNodeCount() const
+{
+    return entries.size();
+}
+
+std::shared_ptr<TransformableNode> Scene::getNode(sf::Uint32 id) const
+{
+    auto it = entries.find(id);
+    return it != entries.end() ? it->second.node : nullptr;
+}
+
+void Scene::load(const SceneFile &file)
+{
+    loadVersion++;
+    std::vector<sf::Uint32> parentIds(file.getNodeCount(), 0);
+    for (unsigned long i = 0; i < file.getNodeCount(); i++) {
+        const SceneFile::NodeRecord &record = file.getNode(i);
+        for (sf::Uint32 child = record.firstChild; child < record.firstChild + record.childCount; child++) {
+            parentIds[child] = record.id;
+        }
+    }
+
+    if (entries.empty()) {
+        const std::vector<std::shared_ptr<TransformableNode> > nodes = file.createNodes();
+        for (unsigned long i = 0; i < nodes.size(); i++) {
+            const SceneFile::NodeRecord &record = file.getNode(i);
+            if (entries.count(record.id) > 0) {
+                continue;
+            }
+            Entry &entry = entries[record.id];
+            entry = { nodes[i], record, parentIds[i],
+                      record.type == SceneFile::NodeType::SPRITE ? file.getTexturePath(record.resource) : "",
+                      file.getText(record), {}, loadVersion };
+            getChildIds(parentIds[i]).push_back(record.id);
+            if (i < file.getRootCount()) {
+                root->addChild(nodes[i]);
+            }
+        }
+        return;
+    }
+
+    for (unsigned long i = 0; i < file.getNodeCount(); i++) {
+        const SceneFile::NodeRecord &record = file.getNode(i);
+        auto it = entries.find(record.id);
+        if (it == entries.end()) {
+            if (parentIds[i] == 0 || entries.count(parentIds[i]) > 0) {
+                insertNode(file, i, parentIds[i]);
+            }
+            continue;
+        }
+        Entry &entry = it->second;
+        if (entry.loadVersion == loadVersion) {
+            continue;
+        }
+        entry.loadVersion = loadVersion;
+        if (entry.parentId != parentIds[i]) {
+            moveNode(record.id, entry, parentIds[i]);
+        }
+        if (!applyChanges(file, record, entry)) {
+            replaceNode(file, i, entry);
+        }
+    }
+
+    std::vector<sf::Uint32> removedIds;
+    for (auto &pair : entries) {
+        if (pair.second.loadVersion != loadVersion) {
+            removedIds.push_back(pair.first);
+        }
+    }
+    for (sf::Uint32 id : removedIds) {
+        removeNode(id);
+    }
+}
+
+void Scene::removeNode(sf::Uint32 id)
+{
+    auto it = entries.find(id);
+    if (it == entries.end()) {
+        return;
+    }
+    detachNode(id, it->second);
+    const std::vector<sf::Uint32> childIds = it->second.childIds;
+    entries.erase(it);
+    for (sf::Uint32 childId : childIds) {
+        removeNode(childId);
+    }
+}
+
+Node &Scene::getParentNode(sf::Uint32 parentId)
+{
+    return parentId == 0 ? static_cast<Node &>(*root) : *entries[parentId].node;
+}
+
+std::vector<sf::Uint32> &Scene::getChildIds(sf::Uint32 parentId)
+{
+    return parentId == 0 ? rootIds : entries[parentId].childIds;
+}
+
+void Scene::insertNode(const SceneFile &file, unsigned long index, sf::Uint32 parentId)
+{
+    const SceneFile::NodeRecord &record = file.getNode(index);
+    Entry &entry = entries[record.id];
+    entry = { file.createNode(index), record, parentId,
+              record.type == SceneFile::NodeType::SPRITE ? file.getTexturePath(record.resource) : "",
+              file.getText(record), {}, loadVersion };
+    getChildIds(parentId).push_back(record.id);
+    getParentNode(parentId).addChild(entry.node);
+}
+
+void Scene::replaceNode(const SceneFile &file, unsigned long index, Entry &entry)
+{
+    const SceneFile::NodeRecord &record = file.getNode(index);
+    std::shared_ptr<TransformableNode> node = file.createNode(index);
+    entry.node->removeFromParent();
+    getParentNode(entry.parentId).addChild(node);
+    for (sf::Uint32 childId : entry.childIds) {
+        node->addChild(entries[childId].node);
+    }
+    entry.node = node;
+    entry.record = record;
+    entry.texturePath = record.type == SceneFile::NodeType::SPRITE ? file.getTexturePath(record.resource) : "";
+    entry.text = file.getText(record);
+}
+
+void Scene::moveNode(sf::Uint32 id, Entry &entry, sf::Uint32 parentId)
+{
+    detachNode(id, entry);
+    entry.parentId = parentId;
+    getChildIds(parentId).push_back(id);
+    getParentNode(parentId).addChild(entry.node);
+}
+
+bool Scene::applyChanges(const SceneFile &file, const SceneFile::NodeRecord &record, Entry &entry)
+{
+    SceneFile::NodeRecord &current = entry.record;
+    const sf::Color color(record.color);
+    const sf::Color currentColor(current.color);
+    if (record.type != current.type || record.characterSize != current.characterSize
+        || color.r != currentColor.r || color.g != currentColor.g || color.b != currentColor.b
+        || (record.type == SceneFile::NodeType::SPRITE && file.getTexturePath(record.resource) != entry.texturePath)) {
+        return false;
+    }
+
+    TransformableNode &node = *entry.node;
+    if (record.originX != current.originX || record.originY != current.originY) {
+        node.setOrigin(record.originX, record.originY);
+    }
+    if (record.x != current.x || record.y != current.y) {
+        node.setPos(record.x, record.y);
+    }
+    if (record.rotation != current.rotation) {
+        node.setRotation(record.rotation);
+    }
+    if (record.scale != current.scale) {
+        node.setScale(record.scale);
+    }
+    if (record.isSelectable != current.isSelectable) {
+        node.setSelectable(record.isSelectable != 0);
+    }
+    node.setZIndex(record.zIndex);
+
+    if (record.type == SceneFile::NodeType::RECTANGLE
+        && (record.width != current.width || record.height != current.height)) {
+        static_cast<RectangleNode &>(node).setSize(record.width, record.height);
+    } else if (record.type == SceneFile::NodeType::CIRCLE && record.width != current.width) {
+        static_cast<CircleNode &>(node).setRadius(record.width);
+    } else if (record.type == SceneFile::NodeType::TEXT) {
+        const sf::String text = file.getText(record);
+        if (text != entry.text) {
+            static_cast<Text &>(node).setString(text);
+            entry.text = text;
+        }
+    }
+    if (color.a != currentColor.a && record.type != SceneFile::NodeType::GROUP) {
+        static_cast<VisualNode &>(node).setAlpha(color.a / 255.0f);
+    }
+    current = record;
+    return true;
+}
+
+void Scene::detachNode(sf::Uint32 id, Entry &entry)
+{
+    if (entry.node->getParent()) {
+        entry.node->removeFromParent();
+    }
+    if (entry.parentId != 0 && entries.count(entry.parentId) == 0) {
+        return;
+    }
+    std::vector<sf::Uint32> &siblingIds = getChildIds(entry.parentId);
+    siblingIds.erase(std::remove(siblingIds.begin(), siblingIds.end(), id), siblingIds.end());
+}
+
+}
@@ -0,0 +1,272 @@
+#include <CE/Resource/SceneFile.hpp>
+#include <CE/Core/CircleNode.hpp>
+#include <CE/Core/RectangleNode.hpp>
+#include <CE/Core/SpriteNode.hpp>
+#include <CE/Resource/ResourceManager.hpp>
+#include <CE/UI/Text.hpp>
+#include <CE/Utility/NodePool.hpp>
+#include <CE/constant.hpp>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ce {
+
+constexpr sf::Uint32 SceneFile::MAGIC;
+constexpr sf::Uint32 SceneFile::VERSION;
+constexpr sf::Uint32 SceneFile::NO_RESOURCE;
+
+static_assert(sizeof(SceneFile::Header) == 24, "unexpected scene header layout");
+static_assert(sizeof(SceneFile::TextureRecord) == 8, "unexpected scene texture record layout");
+static_assert(sizeof(SceneFile::NodeRecord) == 64, "unexpected scene node record layout");
+
+SceneFile::~SceneFile()
+{
+    close();
+}
+
+bool SceneFile::open(const std::string &filename)
+{
+    close();
+#ifdef _WIN32
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    buffer.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(buffer.data(), buffer.size())) {
+        buffer.clear();
+        return false;
+    }
+    data = buffer.data();
+    size = buffer.size();
+#else
+    const int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor == -1) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) == -1 || status.st_size == 0) {
+        ::close(descriptor);
+        return false;
+    }
+    void *mapping = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const char *>(mapping);
+    size = static_cast<std::size_t>(status.st_size);
+#endif
+    if (!checkValid()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SceneFile::close()
+{
+#ifndef _WIN32
+    if (data) {
+        munmap(const_cast<char *>(data), size);
+    }
+#endif
+    buffer.clear();
+    data = nullptr;
+    size = 0;
+}
+
+unsigned long SceneFile::getNodeCount() const
+{
+    return data ? getHeader().nodeCount : 0;
+}
+
+unsigned long SceneFile::getRootCount() const
+{
+    return data ? getHeader().rootCount : 0;
+}
+
+const SceneFile::NodeRecord &SceneFile::getNode(unsigned long index) const
+{
+    return getNodes()[index];
+}
+
+std::string SceneFile::getTexturePath(unsigned long index) const
+{
+    const TextureRecord &texture = getTextures()[index];
+    return std::string(getStrings() + texture.pathOffset, texture.pathLength);
+}
+
+sf::String SceneFile::getText(const NodeRecord &record) const
+{
+    if (record.type != NodeType::TEXT) {
+        return sf::String();
+    }
+    const char *text = getStrings() + record.resource;
+    return sf::String::fromUtf8(text, text + record.resourceLength);
+}
+
+std::shared_ptr<TransformableNode> SceneFile::createNode(unsigned long index) const
+{
+    const NodeRecord &record = getNode(index);
+    return createNode(record, nullptr, record.type == NodeType::SPRITE
+                                       ? ResourceManager::loadTexture(getTexturePath(record.resource))
+                                       : TextureHandle());
+}
+
+std::vector<std::shared_ptr<TransformableNode> > SceneFile::createNodes() const
+{
+    if (!data) {
+        return {};
+    }
+    const Header &header = getHeader();
+    const NodeRecord *records = getNodes();
+
+    std::vector<TextureHandle> textures;
+    textures.reserve(header.textureCount);
+    for (sf::Uint32 i = 0; i < header.textureCount; i++) {
+        textures.push_back(ResourceManager::loadTexture(getTexturePath(i)));
+    }
+
+    unsigned long typeCounts[5] = {};
+    for (sf::Uint32 i = 0; i < header.nodeCount; i++) {
+        typeCounts[static_cast<unsigned int>(records[i].type)]++;
+    }
+    std::vector<NodePool> pools;
+    for (unsigned long count : typeCounts) {
+        pools.emplace_back(std::max(count, 1ul));
+    }
+
+    std::vector<std::shared_ptr<TransformableNode> > nodes(header.nodeCount);
+    const TextureHandle noTexture;
+    for (sf::Uint32 i = 0; i < header.nodeCount; i++) {
+        const NodeRecord &record = records[i];
+        nodes[i] = createNode(record, &pools[static_cast<unsigned int>(record.type)],
+                              record.type == NodeType::SPRITE ? textures[record.resource] : noTexture);
+    }
+    for (sf::Uint32 i = header.nodeCount; i > 0; i--) {
+        const NodeRecord &record = records[i - 1];
+        for (sf::Uint32 child = record.firstChild; child < record.firstChild + record.childCount; child++) {
+            nodes[i - 1]->addChild(nodes[child]);
+        }
+    }
+    return nodes;
+}
+
+std::shared_ptr<MimicNode> SceneFile::instantiate() const
+{
+    auto root = std::make_shared<MimicNode>();
+    const std::vector<std::shared_ptr<TransformableNode> > nodes = createNodes();
+    for (unsigned long i = 0; i < getRootCount(); i++) {
+        root->addChild(nodes[i]);
+    }
+    return root;
+}
+
+const SceneFile::Header &SceneFile::getHeader() const
+{
+    return *reinterpret_cast<const Header *>(data);
+}
+
+const SceneFile::TextureRecord *SceneFile::getTextures() const
+{
+    return reinterpret_cast<const TextureRecord *>(data + sizeof(Header));
+}
+
+const SceneFile::NodeRecord *SceneFile::getNodes() const
+{
+    return reinterpret_cast<const NodeRecord *>(getTextures() + getHeader().textureCount);
+}
+
+const char *SceneFile::getStrings() const
+{
+    return reinterpret_cast<const char *>(getNodes() + getHeader().nodeCount);
+}
+
+bool SceneFile::checkValid() const
+{
+    if (size < sizeof(Header)) {
+        return false;
+    }
+    const Header &header = getHeader();
+    if (header.magic != MAGIC || header.version != VERSION || header.rootCount > header.nodeCount) {
+        return false;
+    }
+    const unsigned long long expectedSize = sizeof(Header)
+            + static_cast<unsigned long long>(header.textureCount) * sizeof(TextureRecord)
+            + static_cast<unsigned long long>(header.nodeCount) * sizeof(NodeRecord) + header.stringSize;
+    if (expectedSize != size) {
+        return false;
+    }
+
+    for (sf::Uint32 i = 0; i < header.textureCount; i++) {
+        const TextureRecord &texture = getTextures()[i];
+        if (static_cast<unsigned long long>(texture.pathOffset) + texture.pathLength > header.stringSize) {
+            return false;
+        }
+    }
+    sf::Uint32 nextChild = header.rootCount;
+    for (sf::Uint32 i = 0; i < header.nodeCount; i++) {
+        const NodeRecord &record = getNodes()[i];
+        if (record.type > NodeType::TEXT || record.id == 0
+            || (record.childCount > 0 && (record.firstChild != nextChild || record.firstChild <= i))
+            || static_cast<unsigned long long>(record.firstChild) + record.childCount > header.nodeCount) {
+            return false;
+        }
+        nextChild += record.childCount;
+        if (record.type == NodeType::SPRITE && record.resource >= header.textureCount) {
+            return false;
+        }
+        if (record.type == NodeType::TEXT
+            && static_cast<unsigned long long>(record.resource) + record.resourceLength > header.stringSize) {
+            return false;
+        }
+    }
+    return nextChild == header.nodeCount;
+}
+
+std::shared_ptr<TransformableNode> SceneFile::createNode(const NodeRecord &record, const NodePool *pool,
+                                                         const TextureHandle &texture) const
+{
+    const NodePool &nodePool = pool ? *pool : NodePool(1);
+    const sf::Color color(record.color);
+    const bool isSelectable = record.isSelectable != 0;
+    std::shared_ptr<TransformableNode> node;
+    if (record.type == NodeType::GROUP) {
+        node = createPooled<MimicNode>(nodePool, isSelectable);
+    } else if (record.type == NodeType::SPRITE) {
+        node = createPooled<SpriteNode>(nodePool, texture, isSelectable);
+    } else if (record.type == NodeType::RECTANGLE) {
+        node = createPooled<RectangleNode>(nodePool, record.width, record.height, color, isSelectable);
+    } else if (record.type == NodeType::CIRCLE) {
+        node = createPooled<CircleNode>(nodePool, record.width, color, isSelectable);
+    } else {
+        node = createPooled<Text>(nodePool, getText(record), record.characterSize, color);
+        if (isSelectable) {
+            node->setSelectable(true);
+        }
+    }
+
+    if (record.originX != 0 || record.originY != 0) {
+        node->setOrigin(record.originX, record.originY);
+    }
+    if (record.x != 0 || record.y != 0) {
+        node->setPos(record.x, record.y);
+    }
+    if (record.rotation != 0) {
+        node->setRotation(record.rotation);
+    }
+    if (record.scale != 1) {
+        node->setScale(record.scale);
+    }
+    node->setZIndex(record.zIndex);
+    return node;
+}
+
+}
@@ -0,0 +1,90 @@
+#include <CE/Resource/SceneWriter.hpp>
+#include <CE/UI/Text.hpp>
+#include <fstream>
+
+namespace ce {
+
+unsigned long SceneWriter::addTexture(const std::string &filename)
+{
+    textures.push_back(filename);
+    return textures.size() - 1;
+}
+
+unsigned long SceneWriter::addNode(SceneFile::NodeType type, long parent)
+{
+    SceneFile::NodeRecord record = {};
+    record.type = type;
+    record.id = static_cast<sf::Uint32>(nodes.size() + 1);
+    record.characterSize = Text::CHARACTER_SIZE;
+    record.scale = 1;
+    record.color = 0xFFFFFFFF;
+    record.resource = SceneFile::NO_RESOURCE;
+    nodes.push_back(record);
+    parents.push_back(parent);
+    texts.emplace_back();
+    return nodes.size() - 1;
+}
+
+SceneFile::NodeRecord &SceneWriter::getNode(unsigned long index)
+{
+    return nodes[index];
+}
+
+void SceneWriter::setText(unsigned long index, const std::string &value)
+{
+    texts[index] = value;
+}
+
+bool SceneWriter::save(const std::string &filename) const
+{
+    std::vector<std::vector<unsigned long> > children(nodes.size());
+    std::vector<unsigned long> order;
+    for (unsigned long i = 0; i < nodes.size(); i++) {
+        if (parents[i] == -1) {
+            order.push_back(i);
+        } else {
+            children[parents[i]].push_back(i);
+        }
+    }
+    const auto rootCount = static_cast<sf::Uint32>(order.size());
+    for (unsigned long i = 0; i < order.size(); i++) {
+        order.insert(order.end(), children[order[i]].begin(), children[order[i]].end());
+    }
+    if (order.size() != nodes.size()) {
+        return false;
+    }
+
+    std::string strings;
+    std::vector<SceneFile::TextureRecord> textureRecords;
+    for (auto &texture : textures) {
+        textureRecords.push_back({ static_cast<sf::Uint32>(strings.size()), static_cast<sf::Uint32>(texture.size()) });
+        strings += texture;
+    }
+    std::vector<SceneFile::NodeRecord> records;
+    auto nextChild = rootCount;
+    for (unsigned long index : order) {
+        SceneFile::NodeRecord record = nodes[index];
+        record.firstChild = nextChild;
+        record.childCount = static_cast<sf::Uint32>(children[index].size());
+        nextChild += record.childCount;
+        if (record.type == SceneFile::NodeType::TEXT) {
+            record.resource = static_cast<sf::Uint32>(strings.size());
+            record.resourceLength = static_cast<sf::Uint32>(texts[index].size());
+            strings += texts[index];
+        }
+        records.push_back(record);
+    }
+
+    const SceneFile::Header header = { SceneFile::MAGIC, SceneFile::VERSION, static_cast<sf::Uint32>(records.size()),
+                                       rootCount, static_cast<sf::Uint32>(textureRecords.size()),
+                                       static_cast<sf::Uint32>(strings.size()) };
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(textureRecords.data()),
+               textureRecords.size() * sizeof(SceneFile::TextureRecord));
+    file.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(SceneFile::NodeRecord));
+    file.write(strings.data(), strings.size());
+    return static_cast<bool>(file);
+}
+
+}
@@ -0,0 +1,30 @@
+#include <CE/Resource/TextureHandle.hpp>
+
+namespace ce {
+
+TextureHandle::TextureHandle() = default;
+
+TextureHandle::TextureHandle(const std::shared_ptr<Entry> &entry) : entry(entry) {}
+
+bool TextureHandle::checkLoaded() const
+{
+    return entry && entry->isLoaded;
+}
+
+bool TextureHandle::checkFailed() const
+{
+    return entry && entry->isFailed;
+}
+
+const sf::Texture *TextureHandle::getTexture() const
+{
+    return checkLoaded() ? entry->texture : nullptr;
+}
+
+const sf::IntRect &TextureHandle::getTextureRect() const
+{
+    static const sf::IntRect EMPTY_RECT;
+    return checkLoaded() ? entry->textureRect : EMPTY_RECT;
+}
+
+}
@@ -75,11 +75,17 @@ void Button::resize()
 {
     updateSize();
     text->resize();
-    text->setOrigin(text->getHalfX(), text->getHalfY());
+    if (text->getOriginX() != text->getHalfX() || text->getOriginY() != text->getHalfY()) {
+        text->setOrigin(text->getHalfX(), text->getHalfY());
+    }
 }
 
-void Button::setState(State state)
+void Button::setState(State value)
 {
+    if (state == value) {
+        return;
+    }
+    state = value;
     if (state == State::DEFAULT) {
         shape.setFillColor(sf::Color(0x333333FF));
     } else if (state == State::MOUSE_OVER || state == State::DISABLED) {
@@ -87,12 +93,15 @@ void Button::setState(State state)
     } else if (state == State::MOUSE_PRESSED) {
         shape.setFillColor(sf::Color::Black);
     }
+    makeChanged();
 }
 
 void Button::updateSize()
 {
     RectangleNode::setSize(size.x, size.y);
-    text->setPos(getHalfX(), getHalfY());
+    if (text->getX() != getHalfX() || text->getY() != getHalfY()) {
+        text->setPos(getHalfX(), getHalfY());
+    }
 }
 
 }
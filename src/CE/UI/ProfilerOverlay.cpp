@@ -0,0 +1,33 @@
+#include <CE/UI/ProfilerOverlay.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <sstream>
+
+namespace ce {
+
+ProfilerOverlay::ProfilerOverlay(const sf::Time &refreshInterval, const sf::Color &color)
+    : Text("", 14, color), refreshInterval(refreshInterval) {}
+
+void ProfilerOverlay::onUpdated()
+{
+    if (refreshClock.getElapsedTime() < refreshInterval) {
+        return;
+    }
+    refreshClock.restart();
+
+    const FrameStats &frame = Profiler::getLastFrame();
+    std::ostringstream stream;
+    stream.precision(2);
+    stream << std::fixed
+           << "frame " << frame.getFrameTime().asMicroseconds() / 1000.f << " ms\n"
+           << "events " << frame.eventTime.asMicroseconds() / 1000.f << " ms\n"
+           << "update " << frame.updateTime.asMicroseconds() / 1000.f << " ms\n"
+           << "draw " << frame.drawTime.asMicroseconds() / 1000.f << " ms\n"
+           << "display " << frame.displayTime.asMicroseconds() / 1000.f << " ms\n"
+           << "draw calls " << frame.drawCallCount << "\n"
+           << "updated nodes " << frame.updatedNodeCount << "\n"
+           << "visited nodes " << frame.visitedNodeCount << "\n"
+           << "transforms " << frame.transformCount;
+    setString(stream.str());
+}
+
+}
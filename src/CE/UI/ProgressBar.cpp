@@ -3,7 +3,8 @@
 namespace ce {
 
 ProgressBar::ProgressBar(float width, float height, const sf::Color &color, float maximum, float minimum)
-    : RectangleNode(width, height, color), maxWidth(width), minimum(minimum), maximum(maximum) {}
+    : RectangleNode(width, height, color), maxWidth(width), minimum(minimum), maximum(maximum),
+      value(maximum) {}
 
 float ProgressBar::getWidth()
 {
@@ -26,6 +27,11 @@ void ProgressBar::setMaximum(float maximum)
     this->maximum = maximum;
 }
 
+float ProgressBar::getValue() const
+{
+    return value;
+}
+
 void ProgressBar::setValue(float value)
 {
     if (value < minimum) {
@@ -1,5 +1,7 @@
 #include <CE/UI/Text.hpp>
-#include <CE/constant.hpp>
+#include <CE/Core/FrameBudget.hpp>
+#include <CE/Resource/ResourceManager.hpp>
+#include <algorithm>
 #include <cmath>
 
 namespace ce {
@@ -11,53 +13,75 @@ void Text::loadFont(const std::string &filename)
     font.loadFromFile(filename);
 }
 
+const sf::Font &Text::getDefaultFont()
+{
+    return font;
+}
+
 Text::Text(const sf::String &string, unsigned int characterSize, const sf::Color &color)
-    : characterSize(characterSize), text(sf::Text(string, font, characterSize))
+    : NodeKindTag(Kind::TEXT), characterSize(characterSize), text(sf::Text(string, font, characterSize))
 {
     text.setFillColor(color);
+    updateLayout();
 }
 
 const sf::String &Text::getString() const
 {
-    return text.getString();
+    return isLayoutPending ? pendingString : text.getString();
 }
 
 void Text::setString(const sf::String &value)
 {
-    text.setString(value);
+    if (value == getString()) {
+        return;
+    }
+    // Under load the layout waits for a due frame; the node keeps showing the previous string until then.
+    pendingString = value;
+    isLayoutPending = true;
+    if (FrameBudget::getCurrent().checkDue(*this)) {
+        applyPendingString();
+    }
 }
 
-void Text::setAlpha(float value)
+const sf::Font &Text::getFont() const
 {
-    text.setFillColor(sf::Color(text.getFillColor().r, text.getFillColor().g,
-                                text.getFillColor().b, (sf::Uint8) (value * 255)));
+    return *text.getFont();
 }
 
-float Text::getWidth()
+void Text::setFont(const sf::Font &value)
 {
-    return text.getLocalBounds().width;
+    if (&value != text.getFont()) {
+        text.setFont(value);
+        updateLayout();
+        onDescendantsChanged();
+    }
 }
 
-float Text::getHeight()
+void Text::setAlpha(float value)
 {
-    return text.getLocalBounds().top + text.getLocalBounds().height;
+    const auto alpha = (sf::Uint8) (value * 255);
+    if (text.getFillColor().a != alpha) {
+        text.setFillColor(sf::Color(text.getFillColor().r, text.getFillColor().g, text.getFillColor().b, alpha));
+        makeChanged();
+    }
 }
 
-void Text::setScale(float value)
+float Text::getWidth()
 {
-    text.setScale(value, value);
-    makeTransformed();
+    applyPendingString();
+    return bounds.width;
 }
 
-sf::FloatRect Text::getRect()
+float Text::getHeight()
 {
-    return text.getGlobalBounds();
+    applyPendingString();
+    return bounds.top + bounds.height;
 }
 
-void Text::setRotation(float value)
+sf::FloatRect Text::getRect()
 {
-    text.setRotation(value * 180 / MATH_PI);
-    makeTransformed();
+    applyPendingString();
+    return text.getTransform().transformRect(bounds);
 }
 
 void Text::setOrigin(float x, float y)
@@ -72,12 +96,6 @@ void Text::setPos(float x, float y)
     makeTransformed();
 }
 
-void Text::rotate(float angle)
-{
-    text.rotate(angle * 180 / MATH_PI);
-    makeTransformed();
-}
-
 void Text::move(float offsetX, float offsetY)
 {
     text.move(std::round(offsetX), std::round(offsetY));
@@ -86,12 +104,43 @@ void Text::move(float offsetX, float offsetY)
 
 void Text::resize()
 {
-    text.setCharacterSize(characterSize);
+    if (text.getCharacterSize() != characterSize) {
+        text.setCharacterSize(characterSize);
+        updateLayout();
+        onDescendantsChanged();
+    }
 }
 
-const sf::Transformable &Text::getTransformable() const
+void Text::update()
 {
-    return text;
+    if (isLayoutPending && FrameBudget::getCurrent().checkDue(*this)) {
+        applyPendingString();
+    }
+    BasicNode::update();
+}
+
+bool Text::checkBatchable() const
+{
+    // Recording glyph quads keeps sf::Text, whose draw reads the shared font, off the render thread.
+    return true;
+}
+
+const sf::Texture *Text::getTexture() const
+{
+    return &text.getFont()->getTexture(text.getCharacterSize());
+}
+
+unsigned long Text::getVertexCount() const
+{
+    return glyphVertices.size();
+}
+
+void Text::writeVertices(sf::Vertex *vertices, const sf::Transform &transform) const
+{
+    const sf::Transform combinedTransform = transform * text.getTransform();
+    for (const auto &vertex : glyphVertices) {
+        *vertices++ = sf::Vertex(combinedTransform.transformPoint(vertex.position), text.getFillColor(), vertex.texCoords);
+    }
 }
 
 const sf::Drawable &Text::getDrawable() const
@@ -99,4 +148,77 @@ const sf::Drawable &Text::getDrawable() const
     return text;
 }
 
+void Text::updateLayout()
+{
+    // Mirrors the glyph walk of sf::Text so bounds and batched quads never force its own geometry rebuild.
+    // Loading a glyph may rewrite the font page that a render thread is drawing from.
+    std::lock_guard<std::recursive_mutex> lock(ResourceManager::getTextureMutex());
+    glyphVertices.clear();
+    bounds = sf::FloatRect();
+    const sf::String &string = text.getString();
+    if (string.isEmpty()) {
+        makeChanged();
+        makeRectChanged();
+        return;
+    }
+
+    const sf::Font &currentFont = *text.getFont();
+    const unsigned int size = text.getCharacterSize();
+    const bool isBold = (text.getStyle() & sf::Text::Bold) != 0;
+    const float whitespaceWidth = currentFont.getGlyph(L' ', size, isBold).advance;
+    const float lineSpacing = currentFont.getLineSpacing(size);
+    float x = 0;
+    auto y = static_cast<float>(size);
+    float minX = y, minY = y, maxX = 0, maxY = 0;
+    sf::Uint32 previous = 0;
+    for (std::size_t i = 0; i < string.getSize(); i++) {
+        const sf::Uint32 current = string[i];
+        if (current == L'\r') {
+            continue;
+        }
+        x += currentFont.getKerning(previous, current, size);
+        previous = current;
+
+        if (current == L' ' || current == L'\t' || current == L'\n') {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            if (current == L' ') {
+                x += whitespaceWidth;
+            } else if (current == L'\t') {
+                x += whitespaceWidth * 4;
+            } else {
+                y += lineSpacing;
+                x = 0;
+            }
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            continue;
+        }
+
+        const sf::Glyph &glyph = currentFont.getGlyph(current, size, isBold);
+        const sf::FloatRect rect(x + glyph.bounds.left, y + glyph.bounds.top, glyph.bounds.width, glyph.bounds.height);
+        glyphVertices.resize(glyphVertices.size() + QUAD_VERTEX_COUNT);
+        fillQuad(&glyphVertices[glyphVertices.size() - QUAD_VERTEX_COUNT], sf::Transform::Identity, rect,
+                 glyph.textureRect, sf::Color::White);
+        minX = std::min(minX, rect.left);
+        minY = std::min(minY, rect.top);
+        maxX = std::max(maxX, rect.left + rect.width);
+        maxY = std::max(maxY, rect.top + rect.height);
+        x += glyph.advance;
+    }
+    bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+    makeChanged();
+    makeRectChanged();
+}
+
+void Text::applyPendingString()
+{
+    if (isLayoutPending) {
+        isLayoutPending = false;
+        text.setString(pendingString);
+        pendingString.clear();
+        updateLayout();
+    }
+}
+
 }
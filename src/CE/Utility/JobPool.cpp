@@ -0,0 +1,137 @@
+#include <CE/Utility/JobPool.hpp>
+#include <algorithm>
+
+namespace ce {
+
+namespace {
+
+thread_local bool isWorkerThread = false;
+
+}
+
+constexpr unsigned long JobPool::CHUNKS_PER_THREAD;
+
+JobPool &JobPool::getShared()
+{
+    static JobPool pool;
+    return pool;
+}
+
+JobPool::JobPool(unsigned int threadCount) : queuedCount(0)
+{
+    // The calling thread takes part in every run, so one thread fewer is spawned.
+    for (unsigned int i = 1; i < threadCount; i++) {
+        workers.emplace_back(new Worker());
+    }
+    for (unsigned long i = 0; i < workers.size(); i++) {
+        workers[i]->thread = std::thread(&JobPool::work, this, i);
+    }
+}
+
+JobPool::~JobPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        isStopped = true;
+    }
+    sleepCondition.notify_all();
+    for (auto &worker : workers) {
+        worker->thread.join();
+    }
+}
+
+unsigned int JobPool::getThreadCount() const
+{
+    return static_cast<unsigned int>(workers.size()) + 1;
+}
+
+void JobPool::run(unsigned long count, const std::function<void(unsigned long)> &job)
+{
+    if (workers.empty() || isWorkerThread || count < 2) {
+        for (unsigned long i = 0; i < count; i++) {
+            job(i);
+        }
+        return;
+    }
+
+    const unsigned long chunkCount = std::min(count, getThreadCount() * CHUNKS_PER_THREAD);
+    Batch batch;
+    batch.job = &job;
+    batch.remainingCount = chunkCount;
+    {
+        // Counted before any task is visible, so a worker that takes one can never drive the count below zero.
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedCount += chunkCount;
+    }
+    for (unsigned long i = 0; i < chunkCount; i++) {
+        Worker &worker = *workers[i % workers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back({ &batch, count * i / chunkCount, count * (i + 1) / chunkCount });
+    }
+    sleepCondition.notify_all();
+
+    Task task;
+    while (batch.remainingCount > 0) {
+        if (findTask(workers.size(), task)) {
+            execute(task);
+        } else {
+            std::unique_lock<std::mutex> lock(doneMutex);
+            doneCondition.wait(lock, [&batch]() -> bool { return batch.remainingCount == 0; });
+        }
+    }
+}
+
+void JobPool::work(unsigned long index)
+{
+    isWorkerThread = true;
+    Task task;
+    while (true) {
+        if (findTask(index, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() -> bool { return isStopped || queuedCount > 0; });
+        if (isStopped) {
+            return;
+        }
+    }
+}
+
+bool JobPool::findTask(unsigned long index, Task &task)
+{
+    if (index < workers.size()) {
+        Worker &worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            task = worker.tasks.back();
+            worker.tasks.pop_back();
+            queuedCount--;
+            return true;
+        }
+    }
+    for (unsigned long i = 1; i <= workers.size(); i++) {
+        Worker &victim = *workers[(index + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            queuedCount--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobPool::execute(const Task &task)
+{
+    for (unsigned long i = task.first; i < task.last; i++) {
+        (*task.batch->job)(i);
+    }
+    if (--task.batch->remainingCount == 0) {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        doneCondition.notify_all();
+    }
+}
+
+}
@@ -0,0 +1,110 @@
+#include <CE/Utility/NodePool.hpp>
+#include <mutex>
+#include <vector>
+
+namespace ce {
+
+constexpr std::size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+struct NodePool::Storage
+{
+    struct Bucket
+    {
+        std::size_t blockSize;
+        void *freeBlock;
+    };
+
+    const unsigned long blocksPerChunk;
+    std::mutex mutex;
+    unsigned long blockCount = 0;
+    unsigned long freeBlockCount = 0;
+    std::vector<Bucket> buckets;
+    std::vector<void *> chunks;
+
+    explicit Storage(unsigned long blocksPerChunk) : blocksPerChunk(blocksPerChunk) {}
+
+    ~Storage()
+    {
+        for (auto chunk : chunks) {
+            ::operator delete(chunk);
+        }
+    }
+
+    Bucket &getBucket(std::size_t blockSize)
+    {
+        for (auto &bucket : buckets) {
+            if (bucket.blockSize == blockSize) {
+                return bucket;
+            }
+        }
+        buckets.push_back({ blockSize, nullptr });
+        return buckets.back();
+    }
+
+    void addChunk(Bucket &bucket)
+    {
+        auto chunk = static_cast<char *>(::operator new(bucket.blockSize * blocksPerChunk));
+        chunks.push_back(chunk);
+        for (unsigned long i = blocksPerChunk; i > 0; i--) {
+            void *block = chunk + bucket.blockSize * (i - 1);
+            *static_cast<void **>(block) = bucket.freeBlock;
+            bucket.freeBlock = block;
+        }
+        blockCount += blocksPerChunk;
+        freeBlockCount += blocksPerChunk;
+    }
+};
+
+static std::size_t getBlockSize(std::size_t size)
+{
+    const std::size_t blockSize = (size + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+    return blockSize < sizeof(void *) ? sizeof(void *) : blockSize;
+}
+
+NodePool::NodePool(unsigned long blocksPerChunk) : storage(std::make_shared<Storage>(blocksPerChunk)) {}
+
+unsigned long NodePool::getBlockCount() const
+{
+    std::lock_guard<std::mutex> lock(storage->mutex);
+    return storage->blockCount;
+}
+
+unsigned long NodePool::getFreeBlockCount() const
+{
+    std::lock_guard<std::mutex> lock(storage->mutex);
+    return storage->freeBlockCount;
+}
+
+void *NodePool::allocate(std::size_t size) const
+{
+    std::lock_guard<std::mutex> lock(storage->mutex);
+    Storage::Bucket &bucket = storage->getBucket(getBlockSize(size));
+    if (!bucket.freeBlock) {
+        storage->addChunk(bucket);
+    }
+    void *block = bucket.freeBlock;
+    bucket.freeBlock = *static_cast<void **>(block);
+    storage->freeBlockCount--;
+    return block;
+}
+
+void NodePool::deallocate(void *block, std::size_t size) const
+{
+    std::lock_guard<std::mutex> lock(storage->mutex);
+    Storage::Bucket &bucket = storage->getBucket(getBlockSize(size));
+    *static_cast<void **>(block) = bucket.freeBlock;
+    bucket.freeBlock = block;
+    storage->freeBlockCount++;
+}
+
+bool NodePool::operator==(const NodePool &other) const
+{
+    return storage == other.storage;
+}
+
+bool NodePool::operator!=(const NodePool &other) const
+{
+    return storage != other.storage;
+}
+
+}
@@ -0,0 +1,88 @@
+#include <CE/Core/MimicNode.hpp>
+#include <CE/Core/Profiler.hpp>
+#include <CE/Core/RectangleNode.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <iostream>
+
+namespace {
+
+constexpr unsigned long LEAF_COUNT = 5;
+
+class TestRoot : public ce::MimicNode
+{
+public:
+    using ce::Node::drawToTarget;
+};
+
+struct DrawCounts
+{
+    unsigned long visitedNodeCount;
+    unsigned long drawCallCount;
+};
+
+DrawCounts draw(TestRoot &root, sf::RenderTarget &target)
+{
+    ce::Profiler profiler;
+    ce::Profiler::startFrame(profiler);
+    root.drawToTarget(target);
+    ce::Profiler::startFrame(profiler);
+    return { ce::Profiler::getLastFrame().visitedNodeCount, ce::Profiler::getLastFrame().drawCallCount };
+}
+
+bool check(const char *name, const DrawCounts &counts, unsigned long visitedNodeCount, unsigned long drawCallCount)
+{
+    if (counts.visitedNodeCount == visitedNodeCount && counts.drawCallCount == drawCallCount) {
+        return true;
+    }
+    std::cerr << name << ": visited " << counts.visitedNodeCount << " nodes and made " << counts.drawCallCount
+              << " draw calls, expected " << visitedNodeCount << " and " << drawCallCount << '\n';
+    return false;
+}
+
+std::shared_ptr<ce::RectangleNode> addLeaf(ce::Node &parent, float x, float y)
+{
+    auto leaf = ce::createShared<ce::RectangleNode>(10, 10);
+    leaf->setPos(x, y);
+    parent.addChild(leaf);
+    return leaf;
+}
+
+}
+
+int main()
+{
+    sf::RenderTexture target;
+    if (!target.create(200, 200)) {
+        std::cerr << "Failed to create render texture\n";
+        return 1;
+    }
+
+    auto root = ce::createShared<TestRoot>();
+    addLeaf(*root, 10, 10);
+    auto group = ce::createShared<ce::MimicNode>();
+    auto innerGroup = ce::createShared<ce::MimicNode>();
+    std::shared_ptr<ce::RectangleNode> innerLeaf;
+    for (unsigned long i = 0; i < LEAF_COUNT; i++) {
+        addLeaf(*group, i * 20.0f, 0);
+        innerLeaf = addLeaf(*innerGroup, i * 20.0f, 20);
+    }
+    group->addChild(innerGroup);
+    group->setPos(1000, 1000);
+    root->addChild(group);
+
+    bool isPassed = true;
+    // The whole off-screen group is skipped: only the root and its on-screen leaf are visited.
+    isPassed &= check("off-screen group", draw(*root, target), 2, 1);
+
+    group->setPos(0, 100);
+    isPassed &= check("on-screen group", draw(*root, target), 4 + LEAF_COUNT * 2, 1 + LEAF_COUNT * 2);
+
+    // A descendant moved back into view keeps its off-screen ancestors from being culled.
+    group->setPos(1000, 1000);
+    innerLeaf->setPos(-900, -900);
+    isPassed &= check("descendant in view", draw(*root, target), 5, 2);
+
+    innerGroup->setVisible(false);
+    isPassed &= check("hidden descendant", draw(*root, target), 2, 1);
+    return isPassed ? 0 : 1;
+}